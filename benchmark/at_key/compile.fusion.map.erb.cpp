@@ -0,0 +1,30 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+<% if input_size > 10 %>
+    #define FUSION_MAX_MAP_SIZE <%= ((input_size + 9) / 10) * 10 %>
+<% end %>
+
+#include <boost/fusion/include/at_key.hpp>
+#include <boost/fusion/include/make_map.hpp>
+
+
+template <int>
+struct x { };
+
+int main() {
+    auto map = boost::fusion::make_map<
+        <%= (1..input_size).map { |n| "x<#{n}>" }.join(', ') %>
+    >(
+        <%= (1..input_size).map { |n| "#{n}" }.join(', ') %>
+    );
+    int result = 0
+        <%= (1..input_size).map { |n|
+            "+ boost::fusion::at_key<x<#{n}>>(map)"
+        }.join(' ') %>
+    ;
+    (void)result;
+}
@@ -0,0 +1,33 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <vector>
+
+using Record = boost::hana::_tuple<int, float, char>;
+
+int main () {
+    std::vector<Record> records;
+    records.reserve(<%= input_size %> * 1000);
+    for (int i = 0; i < <%= input_size %> * 1000; ++i) {
+        records.push_back(boost::hana::make_tuple(
+            std::rand(), static_cast<float>(std::rand()),
+            static_cast<char>(std::rand())
+        ));
+    }
+
+    // When the record is trivially copyable, copying the vector boils down
+    // to a single memmove of the whole buffer.
+    std::vector<Record> copy;
+    boost::hana::benchmark::measure([&] {
+        copy = records;
+    });
+
+    std::cout << "[checksum: " << boost::hana::at_c<0>(copy.back()) << "]" << std::endl;
+}
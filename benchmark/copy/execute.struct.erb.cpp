@@ -0,0 +1,31 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <vector>
+
+struct Record { int x0; float x1; char x2; };
+
+int main () {
+    std::vector<Record> records;
+    records.reserve(<%= input_size %> * 1000);
+    for (int i = 0; i < <%= input_size %> * 1000; ++i) {
+        records.push_back(Record{
+            std::rand(), static_cast<float>(std::rand()),
+            static_cast<char>(std::rand())
+        });
+    }
+
+    // When the record is trivially copyable, copying the vector boils down
+    // to a single memmove of the whole buffer.
+    std::vector<Record> copy;
+    boost::hana::benchmark::measure([&] {
+        copy = records;
+    });
+
+    std::cout << "[checksum: " << copy.back().x0 << "]" << std::endl;
+}
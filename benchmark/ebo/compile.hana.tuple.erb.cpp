@@ -0,0 +1,21 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/tuple.hpp>
+
+
+template <int i>
+struct policy { };
+
+int main() {
+    auto record = boost::hana::make_tuple(
+        0
+        <%= input_size.times.map { |n| ", policy<#{n}>{}" }.join %>
+    );
+    auto copy = record;
+    boost::hana::at_c<0>(copy) = 1;
+    (void)copy;
+}
@@ -0,0 +1,43 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/lazy.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <vector>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct policy { };
+
+struct first {
+    template <typename X, typename ...Policies>
+    constexpr X operator()(X x, Policies const& ...) const
+    { return x; }
+};
+
+int main () {
+    auto make_record = [] {
+        return hana::lazy(first{})(
+            std::rand()
+            <%= input_size.times.map { |n| ", policy<#{n}>{}" }.join %>
+        );
+    };
+    std::vector<decltype(make_record())> records;
+    records.reserve(1 << 16);
+    for (int i = 0; i < (1 << 16); ++i)
+        records.push_back(make_record());
+
+    unsigned long long result = 0;
+    hana::benchmark::measure([&] {
+        for (auto const& record : records)
+            result += hana::eval(record);
+    });
+
+    std::cout << "[checksum: " << result << "]" << std::endl;
+}
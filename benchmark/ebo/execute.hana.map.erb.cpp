@@ -0,0 +1,43 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/type.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <vector>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct policy { };
+
+struct value;
+
+int main () {
+    auto make_record = [] {
+        return hana::make_map(
+            hana::make_pair(hana::type<value>, std::rand())
+            <%= input_size.times.map { |n|
+              ", hana::make_pair(hana::type<policy<#{n}>>, policy<#{n}>{})"
+            }.join %>
+        );
+    };
+    std::vector<decltype(make_record())> records;
+    records.reserve(1 << 16);
+    for (int i = 0; i < (1 << 16); ++i)
+        records.push_back(make_record());
+
+    unsigned long long result = 0;
+    hana::benchmark::measure([&] {
+        for (auto const& record : records)
+            result += record[hana::type<value>];
+    });
+
+    std::cout << "[checksum: " << result << "]" << std::endl;
+}
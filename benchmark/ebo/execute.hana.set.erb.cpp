@@ -0,0 +1,38 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/set.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <vector>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct policy { };
+
+int main () {
+    using Policies = decltype(hana::make_set(
+        <%= input_size.times.map { |n| "policy<#{n}>{}" }.join(', ') %>
+    ));
+
+    struct Record {
+        Policies policies;
+        int value;
+    };
+    std::vector<Record> records(1 << 16);
+    for (auto& record : records)
+        record.value = std::rand();
+
+    unsigned long long result = 0;
+    hana::benchmark::measure([&] {
+        for (auto const& record : records)
+            result += record.value;
+    });
+
+    std::cout << "[checksum: " << result << "]" << std::endl;
+}
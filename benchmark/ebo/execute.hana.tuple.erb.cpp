@@ -0,0 +1,35 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <vector>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct policy { };
+
+int main () {
+    using Record = decltype(hana::make_tuple(
+        std::rand()
+        <%= input_size.times.map { |n| ", policy<#{n}>{}" }.join %>
+    ));
+    std::vector<Record> records(1 << 16);
+    for (auto& record : records)
+        hana::at_c<0>(record) = std::rand();
+
+    unsigned long long result = 0;
+    hana::benchmark::measure([&] {
+        for (auto const& record : records)
+            result += hana::at_c<0>(record);
+    });
+
+    std::cout << "[checksum: " << result << "]" << std::endl;
+}
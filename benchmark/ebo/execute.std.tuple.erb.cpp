@@ -0,0 +1,32 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <tuple>
+#include <vector>
+
+
+template <int i>
+struct policy { };
+
+int main () {
+    using Record = decltype(std::make_tuple(
+        std::rand()
+        <%= input_size.times.map { |n| ", policy<#{n}>{}" }.join %>
+    ));
+    std::vector<Record> records(1 << 16);
+    for (auto& record : records)
+        std::get<0>(record) = std::rand();
+
+    unsigned long long result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (auto const& record : records)
+            result += std::get<0>(record);
+    });
+
+    std::cout << "[checksum: " << result << "]" << std::endl;
+}
@@ -0,0 +1,27 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+
+
+int main () {
+    boost::hana::benchmark::measure([] {
+        long long result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            auto xs = boost::hana::make_tuple(
+                <%= input_size.times.map { 'std::rand() % 2' }.join(', ') %>
+            );
+            auto ys = boost::hana::make_tuple(
+                <%= input_size.times.map { 'std::rand() % 2' }.join(', ') %>
+            );
+
+            result += boost::hana::equal(xs, ys);
+        }
+    });
+}
@@ -0,0 +1,26 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include "measure.hpp"
+#include <array>
+#include <cstdlib>
+
+
+int main () {
+    boost::hana::benchmark::measure([] {
+        long long result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            std::array<int, <%= input_size %>> xs = {{
+                <%= input_size.times.map { 'std::rand() % 2' }.join(', ') %>
+            }};
+            std::array<int, <%= input_size %>> ys = {{
+                <%= input_size.times.map { 'std::rand() % 2' }.join(', ') %>
+            }};
+
+            result += xs == ys;
+        }
+    });
+}
@@ -0,0 +1,33 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/view.hpp>
+
+#include "measure.hpp"
+
+
+struct is_even {
+    template <int i>
+    constexpr auto operator()(boost::hana::benchmark::object<i> const&) const
+    { return boost::hana::bool_<i % 2 == 0>; }
+};
+
+int main () {
+    using boost::hana::benchmark::object;
+    auto values = boost::hana::make_tuple(
+        <%= input_size.times.map { |i| "object<#{i}>{}" }.join(', ') %>
+    );
+
+    boost::hana::benchmark::measure([&] {
+        int count = 0;
+        auto evens = boost::hana::filter_view(boost::hana::reverse_view(values),
+                                              is_even{});
+        boost::hana::for_each(evens, [&](auto const&) { ++count; });
+    });
+}
@@ -0,0 +1,18 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/string.hpp>
+
+
+int main() {
+    // The only occurrence of the character is at the very end.
+    constexpr auto str = boost::hana::string<
+        <%= (0...input_size).map { |n| n == input_size - 1 ? "'.'" : "'a'" }.join(", ") %>
+    >;
+    constexpr auto result = boost::hana::find_substring(str,
+                                        boost::hana::string<'.'>);
+    (void)result;
+}
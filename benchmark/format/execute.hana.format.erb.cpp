@@ -0,0 +1,40 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/format.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/type.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+
+int main () {
+    std::vector<int> values;
+    for (int i = 0; i < 1 << 10; ++i)
+        values.push_back(std::rand() - RAND_MAX / 2);
+
+    auto line = boost::hana::format(
+        <%= input_size.times.map { |n|
+            "BOOST_HANA_STRING(\"#{n == 0 ? '' : ' '}key_#{n}=\"), boost::hana::type<int>, " +
+            "BOOST_HANA_STRING(\" name_#{n}=\"), boost::hana::type<char const*>"
+        }.join(",\n        ") %>
+    );
+
+    char buffer[<%= 64 * input_size %>];
+    std::size_t result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (int value : values) {
+            result += line(buffer, sizeof(buffer),
+                <%= input_size.times.map { |n| "value + #{n}, \"name\"" }.join(", ") %>
+            );
+        }
+    });
+
+    std::cout << "[checksum: " << result << "]" << std::endl;
+}
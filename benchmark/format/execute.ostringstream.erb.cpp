@@ -0,0 +1,32 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <sstream>
+#include <vector>
+
+
+int main () {
+    std::vector<int> values;
+    for (int i = 0; i < 1 << 10; ++i)
+        values.push_back(std::rand() - RAND_MAX / 2);
+
+    std::size_t result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (int value : values) {
+            std::ostringstream line;
+            line
+                <%= input_size.times.map { |n|
+                    "<< \"#{n == 0 ? '' : ' '}key_#{n}=\" << value + #{n} << \" name_#{n}=\" << \"name\""
+                }.join("\n                ") %>;
+            result += line.str().size();
+        }
+    });
+
+    std::cout << "[checksum: " << result << "]" << std::endl;
+}
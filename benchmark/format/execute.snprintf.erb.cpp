@@ -0,0 +1,35 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+
+int main () {
+    std::vector<int> values;
+    for (int i = 0; i < 1 << 10; ++i)
+        values.push_back(std::rand() - RAND_MAX / 2);
+
+    char const* line =
+        <%= input_size.times.map { |n|
+            "\"#{n == 0 ? '' : ' '}key_#{n}=%d name_#{n}=%s\""
+        }.join("\n        ") %>;
+
+    char buffer[<%= 64 * input_size %>];
+    std::size_t result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (int value : values) {
+            result += static_cast<std::size_t>(std::snprintf(buffer, sizeof(buffer), line,
+                <%= input_size.times.map { |n| "value + #{n}, \"name\"" }.join(", ") %>
+            ));
+        }
+    });
+
+    std::cout << "[checksum: " << result << "]" << std::endl;
+}
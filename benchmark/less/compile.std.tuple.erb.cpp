@@ -0,0 +1,19 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <tuple>
+
+
+int main() {
+    constexpr auto xs = std::make_tuple(
+        <%= (1..input_size).to_a.join(', ') %>
+    );
+    constexpr auto ys = std::make_tuple(
+        <%= (1..input_size).to_a.join(', ') %>
+    );
+    constexpr bool result = xs < ys;
+    (void)result;
+}
@@ -0,0 +1,26 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+
+#include "measure.hpp"
+
+
+int main () {
+    using boost::hana::benchmark::object;
+
+    // Each map is kept around, so its values are copied into the next one.
+    boost::hana::benchmark::measure([] {
+        auto map0 = boost::hana::make<boost::hana::Map>();
+        <% input_size.times do |i| %>
+        auto map<%= i + 1 %> = boost::hana::insert(map<%= i %>,
+            boost::hana::make_pair(boost::hana::int_<<%= i %>>, object<<%= i %>>{}));
+        <% end %>
+        (void)map<%= input_size %>;
+    });
+}
@@ -0,0 +1,25 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+
+#include "measure.hpp"
+
+
+int main () {
+    using boost::hana::benchmark::object;
+
+    // Each map is inserted into as an rvalue, so its values are moved into
+    // the next one and they are never copied.
+    boost::hana::benchmark::measure([] {
+        auto map = <%= (0...input_size).inject("boost::hana::make<boost::hana::Map>()") { |map, i|
+            "boost::hana::insert(#{map}, boost::hana::make_pair(boost::hana::int_<#{i}>, object<#{i}>{}))"
+        } %>;
+        (void)map;
+    });
+}
@@ -0,0 +1,25 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+
+#include "measure.hpp"
+
+
+int main () {
+    using boost::hana::benchmark::object;
+
+    boost::hana::benchmark::measure([] {
+        auto map = boost::hana::to<boost::hana::Map>(boost::hana::make_tuple(
+            <%= (0...input_size).map { |i|
+                "boost::hana::make_pair(boost::hana::int_<#{i}>, object<#{i}>{})"
+            }.join(', ') %>
+        ));
+        (void)map;
+    });
+}
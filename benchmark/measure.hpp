@@ -13,17 +13,39 @@ Distributed under the Boost Software License, Version 1.0.
 
 
 namespace boost { namespace hana { namespace benchmark {
+    // Number of copies of `object`s made since the start of the program.
+    inline unsigned long long& copies() {
+        static unsigned long long count = 0;
+        return count;
+    }
+
     template <int i>
     struct object {
         constexpr object() = default;
 
+        // Copies are counted, and they are made artificially expensive so
+        // that they show up in the timings. Moves are free.
         object(object const&) {
+            ++benchmark::copies();
+            std::this_thread::sleep_for(std::chrono::nanoseconds(1));
+        }
+
+        object(object&&) = default;
+
+        // Declaring the move constructor above would otherwise delete the
+        // assignment operators. Copy assignments are counted like copies.
+        object& operator=(object const&) {
+            ++benchmark::copies();
             std::this_thread::sleep_for(std::chrono::nanoseconds(1));
+            return *this;
         }
+
+        object& operator=(object&&) = default;
     };
 
     auto measure = [](auto f) {
         constexpr auto repetitions = 500ull;
+        auto copies_before = benchmark::copies();
         auto start = std::chrono::steady_clock::now();
         for (auto i = repetitions; i > 0; --i) {
             f();
@@ -35,6 +57,8 @@ namespace boost { namespace hana { namespace benchmark {
         );
         std::cout << std::fixed;
         std::cout << "[execution time: " << time.count() << "]" << std::endl;
+        std::cout << "[copies: " << (benchmark::copies() - copies_before) / repetitions
+                  << "]" << std::endl;
     };
 }}}
 
@@ -79,11 +79,16 @@ def cmake_bool(b)
   return false # otherwise
 end
 
-# aspect must be one of :compilation_time, :bloat, :execution_time
-def measure(aspect, template_relative, range)
+# aspect must be one of :compilation_time, :bloat, :execution_time, :copies,
+# :memory_footprint
+# variant, if given, is the name of a variant of the measure targets, which
+# compiles the file with additional compile definitions. The variants are
+# setup in the CMakeLists.txt file of the benchmarks.
+def measure(aspect, template_relative, range, variant = nil)
   measure_file = Pathname.new("@CMAKE_CURRENT_SOURCE_DIR@/measure.cpp")
   template = Pathname.new(template_relative).expand_path
   range = range.to_a
+  suffix = variant.nil? ? "" : ".#{variant}"
 
   if ENV["check.benchmarks"] && range.length >= 2
     range = [range[0], range[-1]]
@@ -107,11 +112,11 @@ def measure(aspect, template_relative, range)
     # Compile the file and get timing statistics. The timing statistics
     # are output to stdout when we compile the file because of the way
     # the `compile.benchmark.measure` CMake target is setup.
-    stdout, stderr, status = make["compile.benchmark.measure"]
+    stdout, stderr, status = make["compile.benchmark.measure#{suffix}"]
     raise "compilation error: #{stderr}\n\n#{code}" if not status.success?
     ctime = stdout.match(/\[compilation time: (.+)\]/i)
     # Size of the generated executable in KB
-    size = File.size("@CMAKE_CURRENT_BINARY_DIR@/compile.benchmark.measure").to_f / 1000
+    size = File.size("@CMAKE_CURRENT_BINARY_DIR@/compile.benchmark.measure#{suffix}").to_f / 1000
 
     # If we didn't match anything, that's because we went too fast, CMake
     # did not have the time to see the changes to the measure file and
@@ -121,15 +126,20 @@ def measure(aspect, template_relative, range)
     stat = ctime.captures[0].to_f if aspect == :compilation_time
     stat = size if aspect == :bloat
 
-    # Run the resulting program and get timing statistics. The statistics
-    # should be written to stdout by the `measure` function of the
-    # `measure.hpp` header.
-    if aspect == :execution_time
-      stdout, stderr, status = make["run.benchmark.measure"]
+    # Run the resulting program and get timing statistics, or the number
+    # of copies of `benchmark::object`s made by each call to the measured
+    # function. The statistics should be written to stdout by the `measure`
+    # function of the `measure.hpp` header. The memory footprint, in bytes,
+    # must be written to stdout by the program itself.
+    labels = {execution_time: "execution time", copies: "copies",
+              memory_footprint: "memory footprint"}
+    if labels.has_key?(aspect)
+      label = labels[aspect]
+      stdout, stderr, status = make["run.benchmark.measure#{suffix}"]
       raise "runtime error: #{stderr}\n\n#{code}" if not status.success?
-      match = stdout.match(/\[execution time: (.+)\]/i)
+      match = stdout.match(/\[#{label}: (.+)\]/i)
       if match.nil?
-        raise ("Could not find [execution time: ...] bit in the output. " +
+        raise ("Could not find [#{label}: ...] bit in the output. " +
                "Did you use the `measure` function in the `measure.hpp` header? " +
                "stdout follows:\n#{stdout}")
       end
@@ -144,12 +154,20 @@ ensure
   progress.finish if progress
 end
 
-def time_execution(erb_file, range)
-  measure(:execution_time, erb_file, range)
+def time_execution(erb_file, range, variant = nil)
+  measure(:execution_time, erb_file, range, variant)
 end
 
-def time_compilation(erb_file, range)
-  measure(:compilation_time, erb_file, range)
+def time_compilation(erb_file, range, variant = nil)
+  measure(:compilation_time, erb_file, range, variant)
+end
+
+def count_copies(erb_file, range, variant = nil)
+  measure(:copies, erb_file, range, variant)
+end
+
+def measure_footprint(erb_file, range, variant = nil)
+  measure(:memory_footprint, erb_file, range, variant)
 end
 
 if __FILE__ == $0
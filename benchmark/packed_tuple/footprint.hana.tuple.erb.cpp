@@ -0,0 +1,20 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/tuple.hpp>
+
+#include <iostream>
+
+
+int main () {
+    // The elements cycle through types of different alignments, so padding
+    // is needed between them unless they are reordered.
+    using Tuple = boost::hana::_tuple<
+        <%= (1..input_size).map { |n| %w(char double char int short)[n % 5] }.join(', ') %>
+    >;
+
+    std::cout << "[memory footprint: " << sizeof(Tuple) << "]" << std::endl;
+}
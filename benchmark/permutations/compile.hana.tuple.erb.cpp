@@ -0,0 +1,26 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+
+// The first permutation satisfying this predicate is the fourth one.
+struct pred {
+    template <typename Perm>
+    constexpr auto operator()(Perm const& perm) const {
+        return boost::hana::equal(boost::hana::last(perm),
+                                  boost::hana::int_<<%= input_size - 2 %>>);
+    }
+};
+
+int main() {
+    constexpr auto tuple = boost::hana::make_tuple(
+        <%= (1..input_size).map { |n| "boost::hana::int_<#{n}>" }.join(', ') %>
+    );
+    constexpr auto result = boost::hana::find_if(boost::hana::permutations(tuple), pred{});
+    (void)result;
+}
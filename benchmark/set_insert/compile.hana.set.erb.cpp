@@ -0,0 +1,21 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/set.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+
+
+template <int>
+struct x { };
+
+int main() {
+    constexpr auto set0 = hana::make_set();
+    <% (1..input_size).each { |n| %>
+        constexpr auto set<%= n %> = hana::insert(set<%= n-1 %>, hana::type<x<<%= n %>>>);
+    <% } %>
+    (void)set<%= input_size %>;
+}
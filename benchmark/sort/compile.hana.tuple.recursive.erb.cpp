@@ -0,0 +1,59 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/functional/flip.hpp>
+#include <boost/hana/functional/partial.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/lazy.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+// This is the recursive quicksort that used to be the only implementation
+// of `sort`; it is kept here for comparison purposes.
+struct sort_recursive {
+    struct helper2 {
+        template <typename Xs, typename Pred>
+        constexpr auto operator()(Xs xs, Pred pred) const {
+            auto pivot = hana::head(xs);
+            auto rest = hana::tail(xs);
+            auto parts = hana::partition(rest,
+                                hana::partial(hana::flip(pred), pivot));
+            return hana::concat(
+                sort_recursive{}(hana::first(parts), pred),
+                hana::prepend(sort_recursive{}(hana::second(parts), pred),
+                              pivot)
+            );
+        }
+    };
+
+    struct helper1 {
+        template <typename Xs, typename Pred>
+        constexpr auto operator()(Xs xs, Pred pred) const {
+            return hana::eval_if(hana::is_empty(hana::tail(xs)),
+                hana::lazy(xs),
+                hana::lazy(helper2{})(xs, pred)
+            );
+        }
+    };
+
+    template <typename Xs, typename Pred>
+    constexpr auto operator()(Xs xs, Pred pred) const {
+        return hana::eval_if(hana::is_empty(xs),
+            hana::lazy(xs),
+            hana::lazy(helper1{})(xs, pred)
+        );
+    }
+};
+
+int main() {
+    constexpr auto tuple = hana::make_tuple(
+        <%= (1..input_size).to_a.shuffle(random: Random.new(input_size))
+                           .map { |n| "hana::int_<#{n}>" }.join(', ') %>
+    );
+    constexpr auto result = sort_recursive{}(tuple, hana::less);
+    (void)result;
+}
@@ -0,0 +1,48 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/detail/constexpr/array.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <utility>
+namespace hana = boost::hana;
+
+
+// This is the insertion sort that used to be used to sort a `tuple_c`;
+// it is kept here for comparison purposes.
+template <typename T, std::size_t N>
+constexpr auto insertion_sort(hana::detail::constexpr_::array<T, N> a) {
+    for (std::size_t i = 1; i < N; ++i) {
+        T t = a[i];
+        std::size_t j = i;
+        for (; j != 0 && t < a[j - 1]; --j)
+            a[j] = a[j - 1];
+        a[j] = t;
+    }
+    return a;
+}
+
+template <typename T, T ...v, std::size_t ...i>
+constexpr auto sort_helper(hana::_tuple_c<T, v...> const&,
+                           std::index_sequence<i...>)
+{
+    constexpr hana::detail::constexpr_::array<T, sizeof...(v)> a{{v...}};
+    constexpr auto result = insertion_sort(a);
+    return hana::tuple_c<T, result[i]...>;
+}
+
+template <typename T, T ...v>
+constexpr auto sort_insertion(hana::_tuple_c<T, v...> const& xs)
+{ return sort_helper(xs, std::make_index_sequence<sizeof...(v)>{}); }
+
+int main() {
+    constexpr auto tuple = hana::tuple_c<int,
+        <%= (1..input_size).to_a.shuffle(random: Random.new(input_size)).join(', ') %>
+    >;
+    constexpr auto result = sort_insertion(tuple);
+    (void)result;
+}
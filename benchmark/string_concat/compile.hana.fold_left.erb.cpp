@@ -0,0 +1,27 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+
+struct concat {
+    template <char ...s1, char ...s2>
+    constexpr auto operator()(boost::hana::_string<s1...>,
+                              boost::hana::_string<s2...>) const
+    { return boost::hana::string<s1..., s2...>; }
+};
+
+int main() {
+    constexpr auto strings = boost::hana::make_tuple(
+        <%= input_size.times.map { |n|
+          "boost::hana::string<" + "field_#{n}".chars.map { |c| "'#{c}'" }.join(", ") + ">"
+        }.join(",\n        ") %>
+    );
+    constexpr auto result = boost::hana::fold.left(strings,
+                                    boost::hana::string<>, concat{});
+    (void)result;
+}
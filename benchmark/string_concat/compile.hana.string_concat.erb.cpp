@@ -0,0 +1,17 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/string.hpp>
+
+
+int main() {
+    constexpr auto result = boost::hana::string_concat(
+        <%= input_size.times.map { |n|
+          "boost::hana::string<" + "field_#{n}".chars.map { |c| "'#{c}'" }.join(", ") + ">"
+        }.join(",\n        ") %>
+    );
+    (void)result;
+}
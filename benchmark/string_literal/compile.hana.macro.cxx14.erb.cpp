@@ -0,0 +1,15 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#define BOOST_HANA_CONFIG_DISABLE_INTEGER_SEQUENCE_BUILTINS
+
+#include <boost/hana/string.hpp>
+
+
+int main() {
+    auto str = BOOST_HANA_STRING("<%= (0...input_size).map { |n| (97 + n % 26).chr }.join %>");
+    (void)str;
+}
@@ -0,0 +1,40 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+
+int main () {
+    // Half of the queries match one of the keys, and half match none.
+    std::vector<std::string> queries;
+    for (int i = 0; i < 1 << 10; ++i)
+        queries.push_back("key_" + std::to_string(std::rand() % (2 * <%= input_size %>)));
+
+    auto dispatch = boost::hana::string_switch(boost::hana::make<boost::hana::Map>(
+        <%= input_size.times.map { |n|
+          "boost::hana::make<boost::hana::Pair>(BOOST_HANA_STRING(\"key_#{n}\"), #{n}ll)"
+        }.join(",\n        ") %>
+    ));
+
+    long long result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (auto const& query : queries) {
+            result += dispatch(query,
+                [](long long x) { return x; },
+                [] { return -1ll; }
+            );
+        }
+    });
+
+    std::cout << "[checksum: " << result << "]" << std::endl;
+}
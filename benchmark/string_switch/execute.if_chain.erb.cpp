@@ -0,0 +1,35 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+
+long long dispatch(std::string const& s) {
+    <% input_size.times do |n| %>
+    if (s.size() == <%= "key_#{n}".size %> && std::memcmp(s.data(), "key_<%= n %>", <%= "key_#{n}".size %>) == 0)
+        return <%= n %>ll;
+    <% end %>
+    return -1ll;
+}
+
+int main () {
+    // Half of the queries match one of the keys, and half match none.
+    std::vector<std::string> queries;
+    for (int i = 0; i < 1 << 10; ++i)
+        queries.push_back("key_" + std::to_string(std::rand() % (2 * <%= input_size %>)));
+
+    long long result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (auto const& query : queries)
+            result += dispatch(query);
+    });
+
+    std::cout << "[checksum: " << result << "]" << std::endl;
+}
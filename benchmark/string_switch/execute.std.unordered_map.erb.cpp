@@ -0,0 +1,33 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+int main () {
+    // Half of the queries match one of the keys, and half match none.
+    std::vector<std::string> queries;
+    for (int i = 0; i < 1 << 10; ++i)
+        queries.push_back("key_" + std::to_string(std::rand() % (2 * <%= input_size %>)));
+
+    std::unordered_map<std::string, long long> const table{
+        <%= input_size.times.map { |n| "{\"key_#{n}\", #{n}ll}" }.join(",\n        ") %>
+    };
+
+    long long result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (auto const& query : queries) {
+            auto it = table.find(query);
+            result += it != table.end() ? it->second : -1ll;
+        }
+    });
+
+    std::cout << "[checksum: " << result << "]" << std::endl;
+}
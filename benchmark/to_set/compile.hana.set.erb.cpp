@@ -0,0 +1,23 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/set.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+
+
+template <int>
+struct x { };
+
+int main() {
+    // Every element appears twice.
+    constexpr auto tuple = hana::make_tuple(
+        <%= (1..input_size).map { |n| "hana::type<x<#{n / 2}>>" }.join(', ') %>
+    );
+    constexpr auto result = hana::to<hana::Set>(tuple);
+    (void)result;
+}
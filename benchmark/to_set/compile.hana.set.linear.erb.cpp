@@ -0,0 +1,47 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/lazy.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/logical.hpp>
+#include <boost/hana/searchable.hpp>
+#include <boost/hana/sequence.hpp>
+#include <boost/hana/set.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+
+
+template <int>
+struct x { };
+
+// This is how to<Set> used to be implemented before sets were indexed by
+// their elements, for comparison purposes.
+struct append_helper {
+    template <typename Set, typename X>
+    constexpr auto operator()(Set set, X x) const
+    { return hana::unpack(hana::append(set.storage, x), hana::make_set); }
+};
+
+struct insert_linear {
+    template <typename Set, typename X>
+    constexpr auto operator()(Set set, X x) const {
+        return hana::eval_if(hana::any_of(set, hana::equal.to(x)),
+            hana::lazy(set),
+            hana::lazy(append_helper{})(set, x)
+        );
+    }
+};
+
+int main() {
+    // Every element appears twice.
+    constexpr auto tuple = hana::make_tuple(
+        <%= (1..input_size).map { |n| "hana::type<x<#{n / 2}>>" }.join(', ') %>
+    );
+    constexpr auto result = hana::fold.left(tuple, hana::make_set(), insert_linear{});
+    (void)result;
+}
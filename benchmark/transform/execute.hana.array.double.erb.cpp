@@ -0,0 +1,27 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/ext/std/array.hpp>
+
+#include "measure.hpp"
+#include <array>
+#include <cstdlib>
+
+
+int main () {
+    boost::hana::benchmark::measure([] {
+        double result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            std::array<double, <%= input_size %>> values = {{
+                <%= input_size.times.map { 'static_cast<double>(std::rand())' }.join(', ') %>
+            }};
+
+            boost::hana::transform(values, [&](auto t) {
+                return result += t;
+            });
+        }
+    });
+}
@@ -0,0 +1,28 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/view.hpp>
+
+#include "measure.hpp"
+
+
+int main () {
+    using boost::hana::benchmark::object;
+    auto values = boost::hana::make_tuple(
+        <%= input_size.times.map { |i| "object<#{i}>{}" }.join(', ') %>
+    );
+
+    boost::hana::benchmark::measure([&] {
+        int count = 0;
+        auto objects = boost::hana::transform_view(
+            boost::hana::reverse_view(values),
+            [](auto const& x) -> auto const& { return x; }
+        );
+        boost::hana::for_each(objects, [&](auto const&) { ++count; });
+    });
+}
@@ -0,0 +1,28 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+
+
+int main () {
+    boost::hana::benchmark::measure([] {
+        long long result = 0;
+        auto xs = boost::hana::make_tuple(
+            <%= input_size.times.map { |n| "static_cast<#{n.even? ? 'int' : 'long'}>(std::rand())" }.join(', ') %>
+        );
+
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            std::size_t index = std::rand() % <%= input_size %>;
+            result += boost::hana::visit_at(xs, index,
+                [](auto x) { return static_cast<long long>(x); },
+                [] { return 0ll; }
+            );
+        }
+    });
+}
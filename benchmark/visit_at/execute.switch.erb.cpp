@@ -0,0 +1,33 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+
+
+int main () {
+    boost::hana::benchmark::measure([] {
+        long long result = 0;
+        auto xs = boost::hana::make_tuple(
+            <%= input_size.times.map { |n| "static_cast<#{n.even? ? 'int' : 'long'}>(std::rand())" }.join(', ') %>
+        );
+
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            std::size_t index = std::rand() % <%= input_size %>;
+            switch (index) {
+                <% input_size.times.each { |n| %>
+                    case <%= n %>:
+                        result += static_cast<long long>(boost::hana::at_c<<%= n %>>(xs));
+                        break;
+                <% } %>
+                default:
+                    break;
+            }
+        }
+    });
+}
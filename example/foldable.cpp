@@ -91,6 +91,40 @@ BOOST_HANA_RUNTIME_CHECK(
 
 }{
 
+//! [fold.balanced]
+auto to_string = [](auto x) {
+    std::ostringstream ss;
+    ss << x;
+    return ss.str();
+};
+
+auto f = [=](auto x, auto y) {
+    return "f(" + to_string(x) + ", " + to_string(y) + ")";
+};
+
+// with an initial state
+BOOST_HANA_RUNTIME_CHECK(
+    fold.balanced(make<Tuple>(2, '3', 4, 5.0), "1", f)
+        ==
+    "f(1, f(f(2, 3), f(4, 5)))"
+);
+
+// without initial state
+BOOST_HANA_RUNTIME_CHECK(
+    fold.balanced(make<Tuple>(1, '2', 3.0, 4, 5), f)
+        ==
+    "f(f(f(1, 2), f(3, 4)), 5)"
+);
+
+// with an associative operation, the result is the same as with the other
+// folds, but the calls are only nested log2(n) levels deep
+BOOST_HANA_CONSTANT_CHECK(
+    fold.balanced(tuple_c<int, 1, 2, 3, 4, 5, 6, 7, 8>, plus) == int_<36>
+);
+//! [fold.balanced]
+
+}{
+
 //! [monadic_fold.right]
 BOOST_HANA_CONSTEXPR_LAMBDA auto safediv = [](auto x, auto y) {
     return eval_if(y == int_<0>,
@@ -167,6 +201,34 @@ BOOST_HANA_RUNTIME_CHECK(ss.str() == "0 1 234 5.5 ");
 
 }{
 
+//! [visit_at]
+auto xs = make<Tuple>(0, '1', std::string{"234"}, 5.5);
+auto to_string = [](auto const& x) {
+    std::stringstream ss;
+    ss << x;
+    return ss.str();
+};
+auto out_of_bounds = [] { return std::string{"out of bounds"}; };
+
+std::size_t i = 2; // known only at runtime
+BOOST_HANA_RUNTIME_CHECK(visit_at(xs, i, to_string, out_of_bounds) == "234");
+BOOST_HANA_RUNTIME_CHECK(visit_at(xs, 4, to_string, out_of_bounds) == "out of bounds");
+
+// elements are passed by reference when possible
+visit_at(xs, 3, [](auto& x) { x = x + x; }, [] { });
+BOOST_HANA_RUNTIME_CHECK(at_c<3>(xs) == 11.0);
+
+// the index of the element is available at compile-time with `with_index`
+auto names = make<Tuple>("a", "b", "c", "d");
+BOOST_HANA_RUNTIME_CHECK(
+    visit_at.with_index(xs, 1, [&](auto index, auto const& x) {
+        return at(names, index) + (" = " + to_string(x));
+    }, out_of_bounds) == "b = 1"
+);
+//! [visit_at]
+
+}{
+
 //! [length]
 BOOST_HANA_CONSTANT_CHECK(length(make<Tuple>()) == size_t<0>);
 BOOST_HANA_CONSTANT_CHECK(length(make<Tuple>(1, '2', 3.0)) == size_t<3>);
@@ -0,0 +1,46 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/ext/std/format.hpp>
+#include <boost/hana/format.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/type.hpp>
+
+#include <cstring>
+using namespace boost::hana;
+
+
+int main() {
+
+{
+
+//! [main]
+// The format is compiled once...
+auto log_line = format(
+    BOOST_HANA_STRING("[request "), type<unsigned>,
+    BOOST_HANA_STRING("] "), type<char const*>,
+    BOOST_HANA_STRING(" took "), type<double>,
+    BOOST_HANA_STRING("ms")
+);
+
+// ...and then written to buffers without parsing anything at runtime.
+char buffer[64];
+std::size_t length = log_line(buffer, sizeof(buffer), 42u, "GET /index", 1.5);
+
+BOOST_HANA_RUNTIME_CHECK(std::strcmp(buffer, "[request 42] GET /index took 1.5ms") == 0);
+BOOST_HANA_RUNTIME_CHECK(length == std::strlen(buffer));
+
+// Like std::snprintf, the output is truncated to the size of the buffer,
+// and the length of the whole output is returned.
+char small[9];
+BOOST_HANA_RUNTIME_CHECK(log_line(small, sizeof(small), 42u, "GET /index", 1.5) == length);
+BOOST_HANA_RUNTIME_CHECK(std::strcmp(small, "[request") == 0);
+//! [main]
+
+}
+
+}
@@ -142,6 +142,14 @@ BOOST_HANA_CONSTEXPR_CHECK(last(make<Tuple>(1, '2', 3.3, nullptr)) == nullptr);
 
 }{
 
+//! [random_access]
+BOOST_HANA_CONSTANT_CHECK(random_access<Tuple>{});
+BOOST_HANA_CONSTANT_CHECK(random_access<Range>{});
+BOOST_HANA_CONSTANT_CHECK(!random_access<Optional>{});
+//! [random_access]
+
+}{
+
 //! [tail]
 BOOST_HANA_CONSTEXPR_CHECK(
     tail(make<Tuple>(1, '2', 3.3, nullptr)) == make<Tuple>('2', 3.3, nullptr)
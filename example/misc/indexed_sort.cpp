@@ -6,7 +6,6 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/integral_constant.hpp>
 #include <boost/hana/pair.hpp>
-#include <boost/hana/range.hpp>
 #include <boost/hana/tuple.hpp>
 #include <boost/hana/type.hpp>
 
@@ -16,9 +15,8 @@ using namespace boost::hana::literals;
 
 
 auto indexed_sort = [](auto list, auto predicate) {
-    auto indexed_list = zip(list, to<Tuple>(range(0_c, size(list))));
-    auto sorted = sort.by(predicate ^on^ head, indexed_list);
-    return make_pair(transform(sorted, head), transform(sorted, last));
+    auto indices = argsort(list, predicate);
+    return make_pair(transform(indices, partial(at, list)), indices);
 };
 
 int main() {
@@ -27,11 +25,11 @@ int main() {
         return sizeof_(t) < sizeof_(u);
     });
     using Tup = decltype(unpack(first(sorted), template_<_tuple>))::type;
-    auto indices = second(indexed_sort(second(sorted), less));
+    auto indices = argsort(second(sorted));
 
     // When accessed through the indices sequence, the tuple appears to be
     // ordered as the `types` above. However, as can be seen in the
-    // static_assert below, the tuple is actually ordered differently.
+    // static_assert below, the tuple is actually ordered differently.
     Tup tup;
     char const(&a)[4] = tup[indices[0_c]];
     char const(&b)[2] = tup[indices[1_c]];
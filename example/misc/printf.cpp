@@ -23,12 +23,6 @@ constexpr auto formats = make_map(
     make_pair(type<char const*>, string<'%', 's'>)
 );
 
-struct concat_strings {
-    template <char ...s1, char ...s2>
-    constexpr auto operator()(_string<s1...>, _string<s2...>) const
-    { return string<s1..., s2...>; }
-};
-
 template <typename ...Tokens>
 constexpr auto format(Tokens ...tokens_) {
     auto tokens = make_tuple(tokens_...);
@@ -44,7 +38,7 @@ constexpr auto format(Tokens ...tokens_) {
         compose(partial(at_key, formats), decltype_)
     );
 
-    auto format_string = fold.left(format_string_tokens, string<>, concat_strings{});
+    auto format_string = unpack(format_string_tokens, string_concat);
     auto variables = filter(tokens, compose(not_, is_a<String>));
     return prepend(variables, format_string);
 }
@@ -0,0 +1,43 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/packed_tuple.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <string>
+using namespace boost::hana;
+
+
+int main() {
+
+{
+
+//! [main]
+// The elements are stored by decreasing alignment...
+static_assert(sizeof(_packed_tuple<char, double, char, int>) <=
+              sizeof(_tuple<char, double, char, int>), "");
+
+// ...but they are still accessed in the order in which they were given.
+BOOST_HANA_CONSTEXPR_CHECK(
+    at_c<2>(make<PackedTuple>('x', 1.5, 'y', 3)) == 'y'
+);
+
+BOOST_HANA_RUNTIME_CHECK(
+    to<Tuple>(make<PackedTuple>('x', 1.5, 'y', 3)) == make<Tuple>('x', 1.5, 'y', 3)
+);
+//! [main]
+
+}{
+
+//! [make<PackedTuple>]
+auto xs = make<PackedTuple>(1, 2.2, 'a', std::string{"bcde"});
+BOOST_HANA_RUNTIME_CHECK(xs == make_packed_tuple(1, 2.2, 'a', std::string{"bcde"}));
+//! [make<PackedTuple>]
+
+}
+
+}
@@ -242,6 +242,31 @@ BOOST_HANA_CONSTANT_CHECK(
 //////////////////////////////////////////////////////////////////////////////
 {
 
+//! [argsort]
+using namespace boost::hana::literals;
+
+// without a predicate
+BOOST_HANA_CONSTANT_CHECK(
+    argsort(make_tuple(1_c, -2_c, 3_c, 0_c)) ==
+            tuple_c<std::size_t, 1, 3, 0, 2>
+);
+
+// with a predicate
+BOOST_HANA_CONSTANT_CHECK(
+    argsort(make_tuple(1_c, -2_c, 3_c, 0_c), greater) ==
+            tuple_c<std::size_t, 2, 0, 3, 1>
+);
+
+// the indices can be used to access the elements in sorted order
+constexpr auto xs = make_tuple(3_c, 1_c, 2_c);
+constexpr auto indices = argsort(xs);
+BOOST_HANA_CONSTANT_CHECK(
+    transform(indices, partial(at, xs)) == sort(xs)
+);
+//! [argsort]
+
+}{
+
 //! [cartesian_product]
 static_assert(
     cartesian_product(
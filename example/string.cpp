@@ -9,10 +9,19 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/datatype.hpp>
 #include <boost/hana/core/is_a.hpp>
 #include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
 #include <boost/hana/optional.hpp>
+#include <boost/hana/pair.hpp>
 #include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
 
+#include <string>
 #include <type_traits>
+#ifdef BOOST_HANA_CONFIG_HAS_STD_STRING_VIEW
+#   include <boost/hana/ext/std/string_view.hpp>
+
+#   include <string_view>
+#endif
 using namespace boost::hana;
 
 
@@ -118,6 +127,110 @@ static_assert(s[0] == 'h' && s[1] == 'i' && s[2] == '\0', "");
 
 }{
 
+#ifdef BOOST_HANA_CONFIG_HAS_STD_STRING_VIEW
+//! [to<std::string_view>]
+constexpr auto str = BOOST_HANA_STRING("hello");
+constexpr std::string_view view = to<std::string_view>(str);
+static_assert(view.size() == 5 && view[4] == 'o', "");
+static_assert(view.data() == to<char const*>(str), "");
+//! [to<std::string_view>]
+#endif
+
+}{
+
+//! [find_substring]
+BOOST_HANA_CONSTANT_CHECK(
+    find_substring(BOOST_HANA_STRING("a.b.c"), BOOST_HANA_STRING(".b")) == just(size_t<1>)
+);
+BOOST_HANA_CONSTANT_CHECK(
+    find_substring(BOOST_HANA_STRING("a.b.c"), BOOST_HANA_STRING("b.a")) == nothing
+);
+//! [find_substring]
+
+}{
+
+//! [starts_with]
+BOOST_HANA_CONSTANT_CHECK(starts_with(BOOST_HANA_STRING("std::vector"), BOOST_HANA_STRING("std::")));
+BOOST_HANA_CONSTANT_CHECK(!starts_with(BOOST_HANA_STRING("vector"), BOOST_HANA_STRING("std::")));
+//! [starts_with]
+
+}{
+
+//! [ends_with]
+BOOST_HANA_CONSTANT_CHECK(ends_with(BOOST_HANA_STRING("string.hpp"), BOOST_HANA_STRING(".hpp")));
+BOOST_HANA_CONSTANT_CHECK(!ends_with(BOOST_HANA_STRING("string.cpp"), BOOST_HANA_STRING(".hpp")));
+//! [ends_with]
+
+}{
+
+//! [split]
+BOOST_HANA_CONSTANT_CHECK(
+    split(BOOST_HANA_STRING("boost.hana.string"), BOOST_HANA_STRING(".")) ==
+    make<Tuple>(BOOST_HANA_STRING("boost"), BOOST_HANA_STRING("hana"), BOOST_HANA_STRING("string"))
+);
+BOOST_HANA_CONSTANT_CHECK(
+    split(BOOST_HANA_STRING("a,,b"), BOOST_HANA_STRING(",")) ==
+    make<Tuple>(BOOST_HANA_STRING("a"), BOOST_HANA_STRING(""), BOOST_HANA_STRING("b"))
+);
+//! [split]
+
+}{
+
+//! [replace_substring]
+BOOST_HANA_CONSTANT_CHECK(
+    replace_substring(BOOST_HANA_STRING("boost.hana.string"),
+                      BOOST_HANA_STRING("."), BOOST_HANA_STRING("::"))
+    ==
+    BOOST_HANA_STRING("boost::hana::string")
+);
+//! [replace_substring]
+
+}{
+
+//! [string_concat]
+BOOST_HANA_CONSTANT_CHECK(
+    string_concat(BOOST_HANA_STRING("boost"), BOOST_HANA_STRING("::"),
+                  BOOST_HANA_STRING("hana")) == BOOST_HANA_STRING("boost::hana")
+);
+BOOST_HANA_CONSTANT_CHECK(string_concat() == BOOST_HANA_STRING(""));
+
+auto parts = make<Tuple>(BOOST_HANA_STRING("ab"), BOOST_HANA_STRING("cd"));
+BOOST_HANA_CONSTANT_CHECK(unpack(parts, string_concat) == BOOST_HANA_STRING("abcd"));
+//! [string_concat]
+
+}{
+
+//! [string_join]
+BOOST_HANA_CONSTANT_CHECK(
+    string_join(make<Tuple>(BOOST_HANA_STRING("boost"), BOOST_HANA_STRING("hana"), BOOST_HANA_STRING("string")),
+         BOOST_HANA_STRING("/"))
+    ==
+    BOOST_HANA_STRING("boost/hana/string")
+);
+//! [string_join]
+
+}{
+
+//! [string_switch]
+auto dispatch = string_switch(make<Map>(
+    make<Pair>(BOOST_HANA_STRING("add"), [](int x, int y) { return x + y; }),
+    make<Pair>(BOOST_HANA_STRING("sub"), [](int x, int y) { return x - y; }),
+    make<Pair>(BOOST_HANA_STRING("mul"), [](int x, int y) { return x * y; })
+));
+
+auto apply_to = [](int x, int y) {
+    return [=](auto op) { return op(x, y); };
+};
+auto unknown = [] { return 0; };
+
+BOOST_HANA_RUNTIME_CHECK(dispatch(std::string{"add"}, apply_to(3, 4), unknown) == 7);
+BOOST_HANA_RUNTIME_CHECK(dispatch(std::string{"mul"}, apply_to(3, 4), unknown) == 12);
+BOOST_HANA_RUNTIME_CHECK(dispatch(std::string{"div"}, apply_to(3, 4), unknown) == 0);
+BOOST_HANA_RUNTIME_CHECK(dispatch("subtract", 3, apply_to(3, 4), unknown) == -1);
+//! [string_switch]
+
+}{
+
 #ifdef BOOST_HANA_CONFIG_ENABLE_STRING_UDL
 //! [_s]
 using namespace boost::hana::literals;
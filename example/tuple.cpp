@@ -84,6 +84,43 @@ BOOST_HANA_CONSTEXPR_CHECK(
 );
 //! [Tuple_interop]
 
+}{
+
+//! [tie]
+std::string a{"a"}, b{"b"}, c{"c"};
+auto refs = tie(a, b, c);
+
+// reverse(refs) refers to c, b and a; nothing is copied
+auto reversed = reverse(refs);
+at_c<0>(reversed) += '!';
+BOOST_HANA_RUNTIME_CHECK(c == "c!");
+
+// filter(refs, ...) refers to the strings it keeps
+auto filtered = filter(refs, [](std::string const&) { return true_; });
+at_c<1>(filtered) = "x";
+BOOST_HANA_RUNTIME_CHECK(b == "x");
+
+// like with std::tie, assigning a tuple assigns to the referred-to objects
+tie(a, b) = make<Tuple>("y", "z");
+BOOST_HANA_RUNTIME_CHECK(a == "y" && b == "z");
+//! [tie]
+
+}{
+
+//! [forward_as_tuple]
+auto concat_strings = [](auto&& ...xs) {
+    std::string result;
+    for_each(forward_as_tuple(xs...), [&](auto const& x) { result += x; });
+    return result;
+};
+
+std::string hello{"hello"};
+BOOST_HANA_RUNTIME_CHECK(
+    unpack(forward_as_tuple(hello, std::string{", "}, "world"), concat_strings)
+    == "hello, world"
+);
+//! [forward_as_tuple]
+
 }
 
 }
\ No newline at end of file
@@ -0,0 +1,106 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+#include <boost/hana/view.hpp>
+using namespace boost::hana;
+
+
+int main() {
+
+{
+
+//! [nth_permutation]
+BOOST_HANA_CONSTEXPR_CHECK(nth_permutation<0>(make_tuple(1, '2', 3.3)) == make_tuple(1, '2', 3.3));
+BOOST_HANA_CONSTEXPR_CHECK(nth_permutation<1>(make_tuple(1, '2', 3.3)) == make_tuple(1, 3.3, '2'));
+BOOST_HANA_CONSTEXPR_CHECK(nth_permutation<2>(make_tuple(1, '2', 3.3)) == make_tuple('2', 1, 3.3));
+BOOST_HANA_CONSTEXPR_CHECK(nth_permutation<5>(make_tuple(1, '2', 3.3)) == make_tuple(3.3, '2', 1));
+//! [nth_permutation]
+
+}{
+
+//! [permutations_view]
+// There are 10! = 3628800 permutations, but only the first two of them are
+// ever created.
+constexpr auto types = tuple_t<char, short, int, long, float,
+                               double, void, char*, int*, void*>;
+
+BOOST_HANA_CONSTANT_CHECK(
+    find_if(permutations_view(types), [](auto perm) {
+        return last(perm) == type<int*>;
+    })
+    ==
+    just(tuple_t<char, short, int, long, float,
+                 double, void, char*, void*, int*>)
+);
+
+BOOST_HANA_CONSTANT_CHECK(length(permutations_view(types)) == size_t<3628800>);
+//! [permutations_view]
+
+}{
+
+//! [cartesian_product_view]
+constexpr auto product = cartesian_product_view(make_tuple(
+    tuple_t<float, double>,
+    make_tuple(int_<4>, int_<8>, int_<16>)
+));
+
+BOOST_HANA_CONSTANT_CHECK(length(product) == size_t<6>);
+BOOST_HANA_CONSTANT_CHECK(at_c<4>(product) == make_tuple(type<double>, int_<8>));
+
+// Each combination is created only when it is visited.
+int total_width = 0;
+for_each(product, [&](auto combination) {
+    total_width += value(at_c<1>(combination));
+});
+BOOST_HANA_RUNTIME_CHECK(total_width == 2 * (4 + 8 + 16));
+//! [cartesian_product_view]
+
+}{
+
+//! [transform_view]
+auto xs = make_tuple(1, 2.2, '3');
+auto doubled = transform_view(xs, [](auto x) { return x + x; });
+
+// The function is only applied to the elements that are accessed.
+BOOST_HANA_RUNTIME_CHECK(at_c<1>(doubled) == 4.4);
+BOOST_HANA_RUNTIME_CHECK(to<Tuple>(doubled) == make_tuple(2, 4.4, '3' + '3'));
+//! [transform_view]
+
+}{
+
+//! [filter_view]
+auto xs = make_tuple(1, 2.2, 3, '4', 5);
+auto ints = filter_view(xs, [](auto x) {
+    return type<decltype(x)> == type<int>;
+});
+
+// The elements are not copied; they are accessed through the view.
+BOOST_HANA_RUNTIME_CHECK(&at_c<1>(ints) == &at_c<2>(xs));
+BOOST_HANA_RUNTIME_CHECK(to<Tuple>(ints) == make_tuple(1, 3, 5));
+//! [filter_view]
+
+}{
+
+//! [slice_view]
+auto xs = make_tuple(1, '2', 3.3, nullptr);
+BOOST_HANA_RUNTIME_CHECK(to<Tuple>(slice_view(xs, int_<1>, int_<3>)) == make_tuple('2', 3.3));
+//! [slice_view]
+
+}{
+
+//! [reverse_view]
+auto xs = make_tuple(1, '2', 3.3);
+BOOST_HANA_RUNTIME_CHECK(to<Tuple>(reverse_view(xs)) == make_tuple(3.3, '2', 1));
+//! [reverse_view]
+
+}
+
+}
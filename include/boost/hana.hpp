@@ -41,17 +41,20 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/lazy.hpp>
 #include <boost/hana/map.hpp>
 #include <boost/hana/optional.hpp>
+#include <boost/hana/packed_tuple.hpp>
 #include <boost/hana/pair.hpp>
 #include <boost/hana/range.hpp>
 #include <boost/hana/set.hpp>
 #include <boost/hana/string.hpp>
 #include <boost/hana/tuple.hpp>
 #include <boost/hana/type.hpp>
+#include <boost/hana/view.hpp>
 
 // Misc
 #include <boost/hana/assert.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core.hpp>
+#include <boost/hana/format.hpp>
 #include <boost/hana/functional.hpp>
 
 
@@ -96,12 +96,59 @@ Distributed under the Boost Software License, Version 1.0.
 // Caveats and other compiler-dependent options
 //////////////////////////////////////////////////////////////////////////////
 
-// Enables some optimizations based on C++1z fold-expressions.
-// Currently always disabled.
-#if 0
+// Empty elements of a `detail::closure`, and hence of a `Tuple`, `Map`,
+// `Set`, `Pair` or lazy application, are stored as base classes so that
+// they take no space. They can still be stored as data members like the
+// other elements by defining the
+// BOOST_HANA_CONFIG_DISABLE_EMPTY_BASE_OPTIMIZATION macro before including
+// any header of the library, which is mostly useful for benchmarking.
+
+// Enables some optimizations based on C++1z fold-expressions, which are
+// used to implement the variadic folds, `for_each`, `any_of`, and the
+// runtime `equal` of Tuples without any recursive instantiations.
+//
+// This is only enabled when the BOOST_HANA_CONFIG_ENABLE_CXX1Z_FOLD_EXPRESSIONS
+// macro is defined before including any header of the library and the
+// compiler supports fold-expressions. It is not the default because the
+// fold-expressions do not reliably compile faster than the C++14
+// implementation; see the benchmark/fold_expressions benchmark.
+#if defined(BOOST_HANA_CONFIG_ENABLE_CXX1Z_FOLD_EXPRESSIONS) &&            \
+        defined(__cpp_fold_expressions) &&                                  \
+        __cpp_fold_expressions >= 201411
 #   define BOOST_HANA_CONFIG_HAS_CXX1Z_FOLD_EXPRESSIONS
 #endif
 
+// Enables the use of the compiler builtins creating integer sequences,
+// which are used to implement `make_index_sequence` and friends without
+// any recursive instantiations. This makes expanding a long sequence,
+// like the characters of a long `BOOST_HANA_STRING`, linear in its length.
+//
+// Clang provides `__make_integer_seq`, and GCC >= 8 provides
+// `__integer_pack`. The C++14 implementation can still be selected by
+// defining the BOOST_HANA_CONFIG_DISABLE_INTEGER_SEQUENCE_BUILTINS macro
+// before including any header of the library, which is mostly useful for
+// benchmarking.
+#if !defined(BOOST_HANA_CONFIG_DISABLE_INTEGER_SEQUENCE_BUILTINS)
+#   if defined(__has_builtin)
+#       if __has_builtin(__make_integer_seq)
+#           define BOOST_HANA_CONFIG_HAS_MAKE_INTEGER_SEQ
+#       endif
+#   endif
+#   if !defined(BOOST_HANA_CONFIG_HAS_MAKE_INTEGER_SEQ) &&                  \
+        defined(BOOST_HANA_CONFIG_GCC) &&                                   \
+        BOOST_HANA_CONFIG_GCC >= BOOST_HANA_CONFIG_VERSION(8, 0, 0)
+#       define BOOST_HANA_CONFIG_HAS_INTEGER_PACK
+#   endif
+#endif
+
+// Tells whether `std::string_view` is available, which is only the case in
+// C++1z. The `boost/hana/ext/std/string_view.hpp` header requires it.
+#if defined(__has_include)
+#   if __has_include(<string_view>) && __cplusplus > 201402L
+#       define BOOST_HANA_CONFIG_HAS_STD_STRING_VIEW
+#   endif
+#endif
+
 // BOOST_HANA_CONFIG_HAS_CONSTEXPR_LAMBDA enables some constructs requiring
 // `constexpr` lambdas, which are not in the language (yet).
 // Currently always disabled.
@@ -10,15 +10,70 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_CLOSURE_HPP
 #define BOOST_HANA_DETAIL_CLOSURE_HPP
 
+#include <boost/hana/config.hpp>
 #include <boost/hana/detail/std/declval.hpp>
 #include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/is_empty.hpp>
+#include <boost/hana/detail/std/is_final.hpp>
+#include <boost/hana/detail/std/remove_reference.hpp>
 #include <boost/hana/detail/std/size_t.hpp>
 
 
 namespace boost { namespace hana { namespace detail {
-    template <detail::std::size_t n, typename Xn>
+    template <typename ...Xs>
+    struct closure_impl;
+
+    namespace closure_detail {
+        template <typename ...Xs>
+        constexpr bool is_closure(closure_impl<Xs...> const*) { return true; }
+        constexpr bool is_closure(...) { return false; }
+
+        // Whether an object of type `Xn` should be stored as a base class
+        // of the `element` holding it instead of as a member. Closures are
+        // never stored that way, because the `element`s of the nested
+        // closure would then make `get<n>` ambiguous on the outer closure.
+        template <typename Xn>
+        constexpr bool use_ebo() {
+#ifdef BOOST_HANA_CONFIG_DISABLE_EMPTY_BASE_OPTIMIZATION
+            return false;
+#else
+            return detail::std::is_empty<Xn>::value &&
+                   !detail::std::is_final<Xn>::value &&
+                   !closure_detail::is_closure(static_cast<
+                        typename detail::std::remove_reference<Xn>::type*
+                   >(nullptr));
+#endif
+        }
+    }
+
+    template <detail::std::size_t n, typename Xn,
+              bool = closure_detail::use_ebo<Xn>()>
     struct element { Xn get; using get_type = Xn; };
 
+    // Empty and non-final types are inherited from instead, which allows
+    // the compiler to apply the empty base optimization to them. The base
+    // is private so that a closure does not look like one of its elements
+    // to traits based on inheritance or on nested types, such as those
+    // used to adapt external types.
+    template <detail::std::size_t n, typename Xn>
+    struct element<n, Xn, true> : private Xn {
+        using get_type = Xn;
+
+        element() = default;
+        element(element const&) = default;
+        element(element&&) = default;
+        element(element&) = default;
+        element& operator=(element const&) = default;
+        element& operator=(element&&) = default;
+
+        template <typename Y, typename = decltype(Xn(
+            detail::std::declval<Y>()
+        ))>
+        constexpr element(Y&& y)
+            : Xn(static_cast<Y&&>(y))
+        { }
+    };
+
     void swallow(...);
 
     // This type is only used for pattern matching.
@@ -29,6 +84,12 @@ namespace boost { namespace hana { namespace detail {
         closure_impl(closure_impl const&) = default;
         closure_impl(closure_impl&) = default;
 
+        // Declaring the move constructor above would otherwise delete the
+        // assignment operators. They are defaulted so that a closure is
+        // trivially copyable whenever all of its elements are.
+        closure_impl& operator=(closure_impl const&) = default;
+        closure_impl& operator=(closure_impl&&) = default;
+
         // This constructor makes it possible to use brace initializers
         // to initialize members of the closure.
         constexpr closure_impl(typename Xs::get_type&& ...xs)
@@ -80,6 +141,16 @@ namespace boost { namespace hana { namespace detail {
     //! Also note that `element<n, Xn>` is guaranteed to have a nested
     //! `get_type` alias equivalent to `Xn`, which is handy to retrieve
     //! that `Xn` without having to do pattern matching.
+    //!
+    //! When `Xn` is an empty and non-final class type (and not a closure
+    //! itself), `element<n, Xn>` inherits privately from `Xn` instead of
+    //! holding it as a member, so that it takes no space inside the closure.
+    //! Hence, the stored object must always be accessed through `get`, which
+    //! handles both representations.
+    //!
+    //! All the special members of a closure are defaulted. Hence, a closure
+    //! is trivially copyable, trivially destructible or trivially default
+    //! constructible whenever all of its elements are.
     template <typename ...Xs>
     using closure = typename make_closure_impl<
         detail::std::make_index_sequence<sizeof...(Xs)>, Xs...
@@ -87,20 +158,41 @@ namespace boost { namespace hana { namespace detail {
 
     //! @ingroup group-details
     //! Get the nth element of a `closure`.
+    //!
+    //! `get` may also be called without an explicit index on an `element`
+    //! itself, in which case it returns the object held by that `element`.
     template <detail::std::size_t n, typename Xn>
     static constexpr Xn const&
-    get(element<n, Xn> const& x)
+    get(element<n, Xn, false> const& x)
     { return x.get; }
 
     template <detail::std::size_t n, typename Xn>
     static constexpr Xn&
-    get(element<n, Xn>& x)
+    get(element<n, Xn, false>& x)
     { return x.get; }
 
     template <detail::std::size_t n, typename Xn>
     static constexpr Xn&&
-    get(element<n, Xn>&& x)
-    { return static_cast<element<n, Xn>&&>(x).get; }
+    get(element<n, Xn, false>&& x)
+    { return static_cast<Xn&&>(x.get); }
+
+    // The casts below are C-style casts because they must convert to a
+    // private base class, which only a C-style cast may do from outside
+    // of `element`.
+    template <detail::std::size_t n, typename Xn>
+    static constexpr Xn const&
+    get(element<n, Xn, true> const& x)
+    { return (Xn const&)x; }
+
+    template <detail::std::size_t n, typename Xn>
+    static constexpr Xn&
+    get(element<n, Xn, true>& x)
+    { return (Xn&)x; }
+
+    template <detail::std::size_t n, typename Xn>
+    static constexpr Xn&&
+    get(element<n, Xn, true>&& x)
+    { return (Xn&&)x; }
 }}} // end namespace boost::hana::detail
 
 #endif // !BOOST_HANA_DETAIL_CLOSURE_HPP
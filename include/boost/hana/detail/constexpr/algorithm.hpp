@@ -99,25 +99,124 @@ namespace boost { namespace hana { namespace detail { namespace constexpr_ {
     { return equal(first1, last1, first2, last2, _ == _); }
 
 
-    template <typename BidirIter, typename BinaryPred>
-    constexpr void sort(BidirIter first, BidirIter last, BinaryPred pred) {
-        if (first == last) return;
-
-        BidirIter i = first;
-        for (++i; i != last; ++i) {
-            BidirIter j = i;
-            auto t = *j;
-            for (BidirIter k = i; k != first && pred(t,  *--k); --j)
-                *j = *k;
-            *j = t;
+    template <typename ForwardIter>
+    constexpr void rotate(ForwardIter first, ForwardIter middle,
+                          ForwardIter last)
+    {
+        constexpr_::reverse(first, middle);
+        constexpr_::reverse(middle, last);
+        constexpr_::reverse(first, last);
+    }
+
+    template <typename RandomIter, typename T, typename BinaryPred>
+    constexpr RandomIter lower_bound(RandomIter first, RandomIter last,
+                                     T const& value, BinaryPred pred)
+    {
+        while (first != last) {
+            RandomIter middle = first + (last - first) / 2;
+            if (pred(*middle, value))
+                first = middle + 1;
+            else
+                last = middle;
         }
+        return first;
     }
 
-    template <typename BidirIter>
-    constexpr void sort(BidirIter first, BidirIter last)
+    template <typename RandomIter, typename T, typename BinaryPred>
+    constexpr RandomIter upper_bound(RandomIter first, RandomIter last,
+                                     T const& value, BinaryPred pred)
+    {
+        while (first != last) {
+            RandomIter middle = first + (last - first) / 2;
+            if (pred(value, *middle))
+                last = middle;
+            else
+                first = middle + 1;
+        }
+        return first;
+    }
+
+    // Merges the sorted ranges [first, middle) and [middle, last) in place,
+    // without any additional storage. The larger range is split in half,
+    // the other one is split at the matching position, and the two inner
+    // parts are swapped with a rotation before merging both halves.
+    template <typename RandomIter, typename BinaryPred>
+    constexpr void inplace_merge(RandomIter first, RandomIter middle,
+                                 RandomIter last, BinaryPred pred)
+    {
+        if (first == middle || middle == last)
+            return;
+
+        if (last - first == 2) {
+            if (pred(*middle, *first))
+                constexpr_::swap(*first, *middle);
+            return;
+        }
+
+        RandomIter cut1 = first, cut2 = middle;
+        if (middle - first > last - middle) {
+            cut1 = first + (middle - first) / 2;
+            cut2 = constexpr_::lower_bound(middle, last, *cut1, pred);
+        }
+        else {
+            cut2 = middle + (last - middle) / 2;
+            cut1 = constexpr_::upper_bound(first, middle, *cut2, pred);
+        }
+
+        constexpr_::rotate(cut1, middle, cut2);
+        RandomIter new_middle = cut1 + (cut2 - middle);
+        constexpr_::inplace_merge(first, cut1, new_middle, pred);
+        constexpr_::inplace_merge(new_middle, cut2, last, pred);
+    }
+
+    // This is a merge sort, which is stable; equivalent elements keep their
+    // relative order. The halves are merged in place, so no additional
+    // storage is required and the elements need not be default-constructible.
+    // This costs O(n log^2 n) element moves, but the number of comparisons,
+    // which are usually what is expensive at compile-time, is O(n log n).
+    template <typename RandomIter, typename BinaryPred>
+    constexpr void sort(RandomIter first, RandomIter last, BinaryPred pred) {
+        if (last - first < 2)
+            return;
+        RandomIter middle = first + (last - first) / 2;
+        constexpr_::sort(first, middle, pred);
+        constexpr_::sort(middle, last, pred);
+        constexpr_::inplace_merge(first, middle, last, pred);
+    }
+
+    template <typename RandomIter>
+    constexpr void sort(RandomIter first, RandomIter last)
     { sort(first, last, _ < _); }
 
 
+    template <typename RandomIter, typename BinaryPred>
+    struct argsort_pred {
+        RandomIter first;
+        BinaryPred pred;
+
+        constexpr bool
+        operator()(detail::std::size_t i, detail::std::size_t j) const
+        { return pred(first[i], first[j]); }
+    };
+
+    // Since `sort` is stable, the indices of equivalent elements are
+    // ordered by position.
+    template <typename RandomIter, typename OutputIter, typename BinaryPred>
+    constexpr void argsort(RandomIter first, RandomIter last, OutputIter out,
+                           BinaryPred pred)
+    {
+        detail::std::size_t n = last - first;
+        for (detail::std::size_t i = 0; i < n; ++i)
+            out[i] = i;
+        constexpr_::sort(out, out + n,
+                         argsort_pred<RandomIter, BinaryPred>{first, pred});
+    }
+
+    template <typename RandomIter, typename OutputIter>
+    constexpr void argsort(RandomIter first, RandomIter last, OutputIter out)
+    { argsort(first, last, out, _ < _); }
+
+
     template <typename InputIter, typename T>
     constexpr InputIter find(InputIter first, InputIter last, T const& value) {
         for (; first != last; ++first)
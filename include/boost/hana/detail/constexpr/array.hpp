@@ -71,7 +71,6 @@ namespace constexpr_ {
         constexpr auto permutations() const
         { return this->permutations(hana::_ < hana::_); }
 
-
         template <typename BinaryPred>
         constexpr auto sort(BinaryPred pred) const {
             array result = *this;
@@ -82,6 +81,16 @@ namespace constexpr_ {
         constexpr auto sort() const
         { return this->sort(hana::_ < hana::_); }
 
+        template <typename BinaryPred>
+        constexpr auto argsort(BinaryPred pred) const {
+            array<detail::std::size_t, Size> result{};
+            constexpr_::argsort(begin(), end(), result.begin(), pred);
+            return result;
+        }
+
+        constexpr auto argsort() const
+        { return this->argsort(hana::_ < hana::_); }
+
         template <typename U>
         constexpr auto iota(U value) const {
             array result = *this;
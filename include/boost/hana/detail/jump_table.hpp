@@ -0,0 +1,70 @@
+/*!
+@file
+Defines `boost::hana::detail::jump_table`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_JUMP_TABLE_HPP
+#define BOOST_HANA_DETAIL_JUMP_TABLE_HPP
+
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/fwd/integral_constant.hpp>
+
+
+namespace boost { namespace hana { namespace detail {
+    //! @ingroup group-details
+    //! Calls a function on the element of a structure at a runtime index.
+    //!
+    //! `jump_table<Get, Xs, F, Fallback, Indices>::%apply(xs, n, f, fallback)`
+    //! calls `f(size_t<n>, Get::apply<n>(xs))` when `n` is in `Indices`,
+    //! and `fallback()` otherwise. This is done with a single indirect call
+    //! through a constexpr table of function pointers, which has one entry
+    //! per index and a last entry for the fallback. The result is converted
+    //! to the type returned by `fallback()`.
+    template <typename Get, typename Xs, typename F, typename Fallback,
+              typename Indices>
+    struct jump_table;
+
+    template <typename Get, typename Xs, typename F, typename Fallback,
+              detail::std::size_t ...i>
+    struct jump_table<Get, Xs, F, Fallback, detail::std::index_sequence<i...>> {
+        using Result = decltype(detail::std::declval<Fallback&>()());
+        using Entry = Result (*)(Xs&, F&, Fallback&);
+
+        template <detail::std::size_t n>
+        static constexpr Result call(Xs& xs, F& f, Fallback&) {
+            return static_cast<Result>(f(
+                _integral_constant<detail::std::size_t, n>{},
+                Get::template apply<n>(static_cast<Xs&&>(xs))
+            ));
+        }
+
+        static constexpr Result call_fallback(Xs&, F&, Fallback& fallback)
+        { return static_cast<Result>(fallback()); }
+
+        static constexpr Entry table[] = {
+            &jump_table::template call<i>..., &jump_table::call_fallback
+        };
+
+        static constexpr Result
+        apply(Xs& xs, detail::std::size_t n, F& f, Fallback& fallback) {
+            constexpr detail::std::size_t size = sizeof...(i);
+            return table[n < size ? n : size](xs, f, fallback);
+        }
+    };
+
+    template <typename Get, typename Xs, typename F, typename Fallback,
+              detail::std::size_t ...i>
+    constexpr typename jump_table<
+        Get, Xs, F, Fallback, detail::std::index_sequence<i...>
+    >::Entry jump_table<
+        Get, Xs, F, Fallback, detail::std::index_sequence<i...>
+    >::table[];
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_JUMP_TABLE_HPP
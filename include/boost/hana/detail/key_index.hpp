@@ -0,0 +1,233 @@
+/*!
+@file
+Defines `boost::hana::detail::key_index`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_KEY_INDEX_HPP
+#define BOOST_HANA_DETAIL_KEY_INDEX_HPP
+
+#include <boost/hana/detail/constexpr/algorithm.hpp>
+#include <boost/hana/detail/constexpr/array.hpp>
+#include <boost/hana/detail/std/conditional.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/type_foldl1.hpp>
+#include <boost/hana/fwd/integral_constant.hpp>
+#include <boost/hana/fwd/string.hpp>
+#include <boost/hana/fwd/type.hpp>
+
+
+namespace boost { namespace hana { namespace detail {
+    namespace key_index_detail {
+        // Keys that can only ever be equal to objects of the same type are
+        // given an index key, which is used to look them up by overload
+        // resolution. Other keys are given `void` as an index key.
+        template <typename T>
+        _type<T> index_key(_type<T> const*);
+
+        template <typename T, T v>
+        _integral_constant<T, v> index_key(_integral_constant<T, v> const*);
+
+        template <char ...s>
+        _string<s...> index_key(_string<s...> const*);
+
+        void index_key(...);
+
+        template <typename Key>
+        using index_key_t = decltype(
+            key_index_detail::index_key(static_cast<Key*>(nullptr))
+        );
+
+        // `IntegralConstant`s of different types may be equal even though
+        // they have different index keys, e.g. `int_<1>` and `long_<1>`.
+        // We keep track of the value type of those keys to detect it.
+        template <typename T>
+        struct value_type_is { using type = T; };
+
+        template <typename T, T v>
+        value_type_is<T> value_type_of(_integral_constant<T, v> const*);
+
+        value_type_is<void> value_type_of(...);
+
+        template <typename Key>
+        using value_type_t = typename decltype(
+            key_index_detail::value_type_of(static_cast<Key*>(nullptr))
+        )::type;
+
+        struct mixed;
+
+        template <typename State, typename T>
+        struct common_value_type { using type = mixed; };
+
+        template <typename T>
+        struct common_value_type<T, T> { using type = T; };
+
+        template <typename T>
+        struct common_value_type<void, T> { using type = T; };
+
+        template <typename T>
+        struct common_value_type<T, void> { using type = T; };
+
+        template <>
+        struct common_value_type<void, void> { using type = void; };
+
+        template <typename Key, detail::std::size_t i>
+        struct entry { };
+
+        template <typename Key, detail::std::size_t i>
+        detail::std::integral_constant<detail::std::size_t, i>
+        find(entry<Key, i> const*);
+
+        template <typename Key>
+        void find(...);
+
+        template <typename Indices, typename ...Keys>
+        struct make_entries;
+
+        // Since the position of the key is part of its `entry`, duplicate
+        // or non-indexable keys never cause an error; they are just never
+        // found by overload resolution.
+        template <detail::std::size_t ...i, typename ...Keys>
+        struct make_entries<detail::std::index_sequence<i...>, Keys...> {
+            struct type : entry<index_key_t<Keys>, i>... { };
+
+            template <typename IndexKey>
+            static constexpr detail::std::size_t first_position() {
+                constexpr bool same[] = {
+                    detail::std::is_same<IndexKey, index_key_t<Keys>>::value...,
+                    true
+                };
+                return detail::constexpr_::find(same, same + sizeof...(Keys),
+                                                true) - same;
+            }
+
+            // A key is kept if it is the only one with its index key, which
+            // we know when it can be found in the index. Otherwise, we check
+            // whether it is the first key with that index key, which is more
+            // costly but only done for duplicate keys.
+            template <typename IndexKey, detail::std::size_t n,
+                      typename Found = decltype(key_index_detail::find<IndexKey>(
+                                            static_cast<type*>(nullptr)))>
+            struct is_first
+                : detail::std::integral_constant<bool, true>
+            { };
+
+            template <typename IndexKey, detail::std::size_t n>
+            struct is_first<IndexKey, n, void>
+                : detail::std::integral_constant<bool,
+                    first_position<IndexKey>() == n
+                >
+            { };
+
+            static constexpr auto unique_positions() {
+                constexpr bool keep[] = {
+                    is_first<index_key_t<Keys>, i>::value..., false
+                };
+                constexpr detail::std::size_t n = detail::constexpr_::count(
+                    keep, keep + sizeof...(Keys), true);
+
+                detail::constexpr_::array<detail::std::size_t, n> positions{};
+                detail::std::size_t* out = &positions[0];
+                for (detail::std::size_t j = 0; j < sizeof...(Keys); ++j)
+                    if (keep[j])
+                        *out++ = j;
+                return positions;
+            }
+        };
+    }
+
+    //! @ingroup group-details
+    //! Result of looking up a key that is known not to be in a `key_index`.
+    struct key_missing { };
+
+    //! @ingroup group-details
+    //! Result of looking up a key that can't be found in a `key_index`
+    //! without comparing it with the keys, one at a time.
+    struct key_unknown { };
+
+    //! @ingroup group-details
+    //! Index allowing compile-time keys to be looked up without doing any
+    //! comparison.
+    //!
+    //! Given the (decayed) types of the keys of an associative structure,
+    //! `key_index<Keys...>` is a type inheriting from one empty `entry` for
+    //! each key whose type determines its value, i.e. `Type`s,
+    //! `IntegralConstant`s and `String`s. The position of such a key is
+    //! then found by overload resolution, which requires a constant number
+    //! of template instantiations instead of one comparison per key.
+    template <typename ...Keys>
+    struct key_index {
+        using entries = typename key_index_detail::make_entries<
+            detail::std::make_index_sequence<sizeof...(Keys)>, Keys...
+        >;
+
+        using value_type = typename detail::type_foldl1<
+            key_index_detail::common_value_type,
+            void, key_index_detail::value_type_t<Keys>...
+        >::type;
+
+        //! Whether all the keys have an index key.
+        static constexpr bool indexable() {
+            constexpr bool indexable[] = {
+                !detail::std::is_same<
+                    key_index_detail::index_key_t<Keys>, void
+                >::value..., true
+            };
+            return detail::constexpr_::find(indexable,
+                                            indexable + sizeof...(Keys),
+                                            false)
+                        == indexable + sizeof...(Keys);
+        }
+
+        //! Whether two keys are equal if and only if they have the same type,
+        //! in which case duplicate keys can be removed by looking at their
+        //! types only.
+        static constexpr bool distinct_by_type() {
+            return indexable() && !detail::std::is_same<
+                value_type, key_index_detail::mixed
+            >::value;
+        }
+
+        //! Looks up a key of type `Key`. The result is either an
+        //! `integral_constant` holding the position of the key, `key_missing`
+        //! or `key_unknown`.
+        template <typename Key,
+                  typename IndexKey = key_index_detail::index_key_t<Key>,
+                  typename KeyValueType = key_index_detail::value_type_t<Key>>
+        using lookup = typename detail::std::conditional<
+            detail::std::is_same<IndexKey, void>::value,
+            key_unknown,
+            typename detail::std::conditional<
+                !detail::std::is_same<
+                    decltype(key_index_detail::find<IndexKey>(
+                        static_cast<typename entries::type*>(nullptr))),
+                    void
+                >::value,
+                decltype(key_index_detail::find<IndexKey>(
+                    static_cast<typename entries::type*>(nullptr))),
+                typename detail::std::conditional<
+                    indexable() && (
+                        detail::std::is_same<KeyValueType, void>::value ||
+                        detail::std::is_same<value_type, void>::value ||
+                        detail::std::is_same<value_type, KeyValueType>::value
+                    ),
+                    key_missing, key_unknown
+                >::type
+            >::type
+        >::type;
+
+        //! Returns a `constexpr_::array` holding the positions of the first
+        //! occurence of each distinct key, in increasing order. This only
+        //! makes sense when `distinct_by_type()` is true.
+        static constexpr auto unique_positions()
+        { return entries::unique_positions(); }
+    };
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_KEY_INDEX_HPP
@@ -10,6 +10,7 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_STD_INTEGER_SEQUENCE_HPP
 #define BOOST_HANA_DETAIL_STD_INTEGER_SEQUENCE_HPP
 
+#include <boost/hana/config.hpp>
 #include <boost/hana/detail/std/size_t.hpp>
 
 
@@ -20,6 +21,23 @@ namespace boost { namespace hana { namespace detail { namespace std {
     template <size_t ...n>
     using index_sequence = integer_sequence<size_t, n...>;
 
+#if defined(BOOST_HANA_CONFIG_HAS_MAKE_INTEGER_SEQ)
+
+    template <typename T, T n>
+    using make_integer_sequence = __make_integer_seq<integer_sequence, T, n>;
+
+    template <size_t n>
+    using make_index_sequence = make_integer_sequence<size_t, n>;
+
+#elif defined(BOOST_HANA_CONFIG_HAS_INTEGER_PACK)
+
+    template <typename T, T n>
+    using make_integer_sequence = integer_sequence<T, __integer_pack(n)...>;
+
+    template <size_t n>
+    using make_index_sequence = make_integer_sequence<size_t, n>;
+
+#else
 
     namespace int_seq_detail {
         template <typename L, typename R>
@@ -68,6 +86,8 @@ namespace boost { namespace hana { namespace detail { namespace std {
     using make_index_sequence =
         typename int_seq_detail::make_index_sequence<n>::type;
 
+#endif
+
     template <typename ...T>
     using index_sequence_for = make_index_sequence<sizeof...(T)>;
 }}}} // end namespace boost::hana::detail::std
@@ -0,0 +1,111 @@
+/*!
+@file
+Defines `boost::hana::detail::variadic::fold_balanced`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_VARIADIC_FOLD_BALANCED_HPP
+#define BOOST_HANA_DETAIL_VARIADIC_FOLD_BALANCED_HPP
+
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+
+
+namespace boost { namespace hana { namespace detail { namespace variadic {
+    namespace fold_balanced_detail {
+        template <typename ...Ys>
+        constexpr auto make_closure(Ys&& ...ys) {
+            return detail::closure<typename detail::std::decay<Ys>::type...>{
+                static_cast<Ys&&>(ys)...
+            };
+        }
+
+        // Combines the adjacent pairs of elements of a closure, which
+        // halves the number of elements. When that number is odd, the
+        // last element is carried over to the next level as-is.
+        template <bool odd>
+        struct combine;
+
+        template <>
+        struct combine<false> {
+            template <typename F, typename Xs, detail::std::size_t ...i>
+            static constexpr auto
+            apply(F& f, Xs&& xs, detail::std::index_sequence<i...>) {
+                return fold_balanced_detail::make_closure(
+                    f(detail::get<2 * i>(static_cast<Xs&&>(xs)),
+                      detail::get<2 * i + 1>(static_cast<Xs&&>(xs)))...
+                );
+            }
+        };
+
+        template <>
+        struct combine<true> {
+            template <typename F, typename Xs, detail::std::size_t ...i>
+            static constexpr auto
+            apply(F& f, Xs&& xs, detail::std::index_sequence<i...>) {
+                constexpr detail::std::size_t n = 2 * sizeof...(i);
+                return fold_balanced_detail::make_closure(
+                    f(detail::get<2 * i>(static_cast<Xs&&>(xs)),
+                      detail::get<2 * i + 1>(static_cast<Xs&&>(xs)))...,
+                    detail::get<n>(static_cast<Xs&&>(xs))
+                );
+            }
+        };
+
+        template <detail::std::size_t n>
+        struct fold_balanced_impl {
+            template <typename F, typename Xs>
+            static constexpr auto apply(F& f, Xs&& xs) {
+                return fold_balanced_impl<(n + 1) / 2>::apply(f,
+                    combine<n % 2 == 1>::apply(f, static_cast<Xs&&>(xs),
+                        detail::std::make_index_sequence<n / 2>{})
+                );
+            }
+        };
+
+        template <>
+        struct fold_balanced_impl<1> {
+            template <typename F, typename Xs>
+            static constexpr auto apply(F&, Xs&& xs)
+            { return detail::get<0>(static_cast<Xs&&>(xs)); }
+        };
+    }
+
+    //! @ingroup group-details
+    //! Folds a non-empty pack of objects with an associative binary
+    //! operation, by combining them pairwise.
+    //!
+    //! `fold_balanced(f, x1, ..., xn)` combines the adjacent pairs of
+    //! objects with `f`, and then repeats the process with the results
+    //! until a single object is left. For example,
+    //! @code
+    //!     fold_balanced(f, x1, x2, x3, x4, x5) == f(f(f(x1, x2), f(x3, x4)), x5)
+    //! @endcode
+    //!
+    //! Hence, the calls to `f` are only nested `log2(n)` levels deep,
+    //! instead of `n` levels deep for `foldl1` and `foldr1`, and the result
+    //! is the same as with those folds whenever `f` is associative.
+    //!
+    //! `fold_balanced_detail::fold_balanced_impl<n>::apply(f, xs)` may also
+    //! be used directly to fold the elements of a `closure` of size `n`.
+    struct _fold_balanced {
+        template <typename F, typename X1, typename ...Xn>
+        constexpr auto operator()(F&& f, X1&& x1, Xn&& ...xn) const {
+            using Impl = fold_balanced_detail::fold_balanced_impl<
+                sizeof...(xn) + 1
+            >;
+            return Impl::apply(f, detail::closure<X1&&, Xn&&...>{
+                static_cast<X1&&>(x1), static_cast<Xn&&>(xn)...
+            });
+        }
+    };
+
+    constexpr _fold_balanced fold_balanced{};
+}}}} // end namespace boost::hana::detail::variadic
+
+#endif // !BOOST_HANA_DETAIL_VARIADIC_FOLD_BALANCED_HPP
@@ -10,6 +10,7 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_VARIADIC_FOLDL1_HPP
 #define BOOST_HANA_DETAIL_VARIADIC_FOLDL1_HPP
 
+#include <boost/hana/config.hpp>
 #include <boost/hana/core/when.hpp>
 
 
@@ -195,6 +196,44 @@ namespace boost { namespace hana { namespace detail { namespace variadic {
         }
     };
 
+#ifdef BOOST_HANA_CONFIG_HAS_CXX1Z_FOLD_EXPRESSIONS
+    namespace foldl1_detail {
+        template <typename X>
+        struct arg { X&& x; };
+
+        // Holds the result of folding the elements seen so far. Folding
+        // the accumulator with the next element gives a new accumulator,
+        // so that a single left fold-expression over `|` folds the whole
+        // pack, without instantiating anything recursively.
+        template <typename F, typename State>
+        struct accumulator {
+            F& f;
+            State state;
+
+            template <typename X>
+            constexpr auto operator|(arg<X>&& x) && -> accumulator<F,
+                decltype(f(static_cast<State&&>(state), static_cast<X&&>(x.x)))
+            > {
+                return {f, f(static_cast<State&&>(state),
+                             static_cast<X&&>(x.x))};
+            }
+
+            constexpr State get() &&
+            { return static_cast<State&&>(state); }
+        };
+    }
+
+    struct _foldl1 {
+        template <typename F, typename X1, typename ...Xn>
+        constexpr decltype(auto) operator()(F&& f, X1&& x1, Xn&& ...xn) const {
+            return (
+                foldl1_detail::accumulator<F, X1>{f, static_cast<X1&&>(x1)}
+                    | ... |
+                foldl1_detail::arg<Xn>{static_cast<Xn&&>(xn)}
+            ).get();
+        }
+    };
+#else
     struct _foldl1 {
         template <typename F, typename X1, typename ...Xn>
         constexpr decltype(auto) operator()(F&& f, X1&& x1, Xn&& ...xn) const {
@@ -203,6 +242,7 @@ namespace boost { namespace hana { namespace detail { namespace variadic {
             );
         }
     };
+#endif
 
     constexpr _foldl1 foldl1{};
     constexpr auto foldl = foldl1;
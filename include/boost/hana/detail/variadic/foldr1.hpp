@@ -10,6 +10,7 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_VARIADIC_FOLDR1_HPP
 #define BOOST_HANA_DETAIL_VARIADIC_FOLDR1_HPP
 
+#include <boost/hana/config.hpp>
 #include <boost/hana/core/when.hpp>
 
 
@@ -181,6 +182,70 @@ namespace boost { namespace hana { namespace detail { namespace variadic {
         }
     };
 
+#ifdef BOOST_HANA_CONFIG_HAS_CXX1Z_FOLD_EXPRESSIONS
+    namespace foldr1_detail {
+        template <typename F, typename State>
+        struct accumulator {
+            F& f;
+            State state;
+
+            constexpr State get() &&
+            { return static_cast<State&&>(state); }
+        };
+
+        template <typename F>
+        struct last { F& f; };
+
+        // Folding an element with the accumulator of the elements on its
+        // right gives a new accumulator, so that a single right
+        // fold-expression over `|` folds the whole pack. The last element
+        // of a pack is folded with `last` instead, which gives the initial
+        // accumulator for `foldr1`.
+        template <typename X>
+        struct arg {
+            X&& x;
+
+            template <typename F, typename State>
+            constexpr auto operator|(accumulator<F, State>&& acc) && ->
+                accumulator<F, decltype(acc.f(
+                    static_cast<X&&>(x), static_cast<State&&>(acc.state)
+                ))>
+            {
+                return {acc.f, acc.f(static_cast<X&&>(x),
+                                     static_cast<State&&>(acc.state))};
+            }
+
+            template <typename F>
+            constexpr accumulator<F, X> operator|(last<F>&& l) &&
+            { return {l.f, static_cast<X&&>(x)}; }
+        };
+    }
+
+    struct _foldr1 {
+        template <typename F, typename X1, typename ...Xn>
+        constexpr decltype(auto) operator()(F&& f, X1&& x1, Xn&& ...xn) const {
+            return (
+                foldr1_detail::arg<X1>{static_cast<X1&&>(x1)} |
+                (foldr1_detail::arg<Xn>{static_cast<Xn&&>(xn)} | ... |
+                    foldr1_detail::last<F>{f})
+            ).get();
+        }
+    };
+
+    constexpr _foldr1 foldr1{};
+
+    struct _foldr {
+        template <typename F, typename State, typename ...Xn>
+        constexpr decltype(auto) operator()(F&& f, State&& state, Xn&& ...xn) const {
+            return (
+                foldr1_detail::arg<Xn>{static_cast<Xn&&>(xn)} | ... |
+                foldr1_detail::accumulator<F, State>{
+                    f, static_cast<State&&>(state)
+                }
+            ).get();
+        }
+    };
+#else
     struct _foldr1 {
         template <typename F, typename X1, typename ...Xn>
         constexpr decltype(auto) operator()(F&& f, X1&& x1, Xn&& ...xn) const {
@@ -201,6 +266,8 @@ namespace boost { namespace hana { namespace detail { namespace variadic {
         }
     };
 
+#endif
+
     constexpr _foldr foldr{};
 }}}} // end namespace boost::hana::detail::variadic
 
@@ -10,14 +10,21 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_VARIADIC_FOR_EACH_HPP
 #define BOOST_HANA_DETAIL_VARIADIC_FOR_EACH_HPP
 
+#include <boost/hana/config.hpp>
+
+
 namespace boost { namespace hana { namespace detail { namespace variadic {
     struct _for_each {
         template <typename F, typename ...Xs>
         constexpr void operator()(F&& f, Xs&& ...xs) const {
+#ifdef BOOST_HANA_CONFIG_HAS_CXX1Z_FOLD_EXPRESSIONS
+            ((void)f(static_cast<Xs&&>(xs)), ...);
+#else
             using Swallow = int[];
             (void)Swallow{1,
                 ((void)f(static_cast<Xs&&>(xs)), 1)...
             };
+#endif
         }
     };
 
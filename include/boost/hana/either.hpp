@@ -34,7 +34,7 @@ namespace boost { namespace hana {
     // left
     //////////////////////////////////////////////////////////////////////////
     template <typename X>
-    struct _left : operators::adl {
+    struct _left : operators::adl_for<_left<X>> {
         X value;
         using hana = _left;
         using datatype = Either;
@@ -76,7 +76,7 @@ namespace boost { namespace hana {
     // right
     //////////////////////////////////////////////////////////////////////////
     template <typename X>
-    struct _right : operators::adl {
+    struct _right : operators::adl_for<_right<X>> {
         X value;
         using hana = _right;
         using datatype = Either;
@@ -14,11 +14,16 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/when.hpp>
 #include <boost/hana/detail/std/move.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/iterable.hpp>
 #include <boost/hana/sequence.hpp>
 
+#include <boost/fusion/sequence/intrinsic/at.hpp>
 #include <boost/fusion/sequence/intrinsic/empty.hpp>
 #include <boost/fusion/sequence/intrinsic/front.hpp>
+#include <boost/fusion/sequence/intrinsic/size.hpp>
 
 
 namespace boost { namespace hana {
@@ -29,6 +34,18 @@ namespace boost { namespace hana {
         { };
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <typename S>
+    struct length_impl<S, when<detail::is_fusion_sequence<S>{}()>> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const&) {
+            using Size = typename ::boost::fusion::result_of::size<Xs>::type;
+            return size_t<Size::value>;
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Iterable
     //////////////////////////////////////////////////////////////////////////
@@ -56,6 +73,27 @@ namespace boost { namespace hana {
         }
     };
 
+    template <typename S>
+    struct at_impl<S, when<detail::is_fusion_sequence<S>{}()>> {
+        template <typename Xs, typename N>
+        static constexpr auto const& apply(Xs const& xs, N const&) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            return ::boost::fusion::at_c<n>(xs);
+        }
+
+        template <typename Xs, typename N>
+        static constexpr auto& apply(Xs& xs, N const&) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            return ::boost::fusion::at_c<n>(xs);
+        }
+
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs&& xs, N const&) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            return detail::std::move(::boost::fusion::at_c<n>(xs));
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Sequence
     //////////////////////////////////////////////////////////////////////////
@@ -58,6 +58,9 @@ namespace boost { namespace hana {
 
     //////////////////////////////////////////////////////////////////////////
     // Iterable (the rest is in detail/common.hpp)
+    //
+    // `random_access` is not specialized, because `fusion::at` walks the
+    // list to reach an element.
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct tail_impl<ext::boost::fusion::List> {
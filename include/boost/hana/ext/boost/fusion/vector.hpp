@@ -15,6 +15,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/std/integral_constant.hpp>
 #include <boost/hana/detail/std/is_same.hpp>
 #include <boost/hana/ext/boost/fusion/detail/common.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/iterable.hpp>
 #include <boost/hana/monad_plus.hpp>
 
@@ -62,6 +63,11 @@ namespace boost { namespace hana {
         }
     };
 
+    template <>
+    struct random_access<ext::boost::fusion::Vector>
+        : _integral_constant<bool, true>
+    { };
+
     //////////////////////////////////////////////////////////////////////////
     // MonadPlus
     //////////////////////////////////////////////////////////////////////////
@@ -14,18 +14,22 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/convert.hpp>
 #include <boost/hana/core/datatype.hpp>
 #include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
 #include <boost/hana/ext/boost/mpl/integral_c.hpp>
 #include <boost/hana/foldable.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/iterable.hpp>
 #include <boost/hana/searchable.hpp>
 #include <boost/hana/type.hpp>
 
+#include <boost/mpl/at.hpp>
 #include <boost/mpl/empty.hpp>
 #include <boost/mpl/front.hpp>
 #include <boost/mpl/pop_front.hpp>
 #include <boost/mpl/push_front.hpp>
 #include <boost/mpl/equal.hpp>
 #include <boost/mpl/sequence_tag.hpp>
+#include <boost/mpl/size.hpp>
 #include <boost/mpl/vector.hpp>
 
 
@@ -127,6 +131,13 @@ namespace boost { namespace hana {
         : Iterable::fold_right_nostate_impl<ext::boost::mpl::Vector>
     { };
 
+    template <>
+    struct length_impl<ext::boost::mpl::Vector> {
+        template <typename xs>
+        static constexpr auto apply(xs)
+        { return size_t< ::boost::mpl::size<xs>::value>; }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Iterable
     //////////////////////////////////////////////////////////////////////////
@@ -151,6 +162,20 @@ namespace boost { namespace hana {
         { return typename ::boost::mpl::empty<xs>::type{}; }
     };
 
+    template <>
+    struct at_impl<ext::boost::mpl::Vector> {
+        template <typename xs, typename N>
+        static constexpr auto apply(xs, N const&) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            return type<typename ::boost::mpl::at_c<xs, n>::type>;
+        }
+    };
+
+    template <>
+    struct random_access<ext::boost::mpl::Vector>
+        : _integral_constant<bool, true>
+    { };
+
     //////////////////////////////////////////////////////////////////////////
     // Searchable
     //////////////////////////////////////////////////////////////////////////
@@ -14,6 +14,9 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/datatype.hpp>
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/detail/std/move.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/iterable.hpp>
 #include <boost/hana/monad_plus.hpp>
 #include <boost/hana/sequence.hpp>
@@ -39,6 +42,17 @@ namespace boost { namespace hana {
         using type = ext::boost::Tuple;
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct length_impl<ext::boost::Tuple> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const&) {
+            return size_t< ::boost::tuples::length<Xs>::value>;
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Iterable
     //////////////////////////////////////////////////////////////////////////
@@ -92,6 +106,32 @@ namespace boost { namespace hana {
         { return false_; }
     };
 
+    template <>
+    struct at_impl<ext::boost::Tuple> {
+        template <typename Xs, typename N>
+        static constexpr auto const& apply(Xs const& xs, N const&) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            return ::boost::tuples::get<n>(xs);
+        }
+
+        template <typename Xs, typename N>
+        static constexpr auto& apply(Xs& xs, N const&) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            return ::boost::tuples::get<n>(xs);
+        }
+
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs&& xs, N const&) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            return detail::std::move(::boost::tuples::get<n>(xs));
+        }
+    };
+
+    template <>
+    struct random_access<ext::boost::Tuple>
+        : _integral_constant<bool, true>
+    { };
+
     //////////////////////////////////////////////////////////////////////////
     // MonadPlus
     //////////////////////////////////////////////////////////////////////////
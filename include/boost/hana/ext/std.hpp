@@ -17,6 +17,7 @@ Distributed under the Boost Software License, Version 1.0.
 #endif
 
 #include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/ext/std/format.hpp>
 #include <boost/hana/ext/std/integer_sequence.hpp>
 #include <boost/hana/ext/std/integral_constant.hpp>
 #include <boost/hana/ext/std/pair.hpp>
@@ -25,4 +26,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/ext/std/utility.hpp>
 #include <boost/hana/ext/std/vector.hpp>
 
+#ifdef BOOST_HANA_CONFIG_HAS_STD_STRING_VIEW
+#   include <boost/hana/ext/std/string_view.hpp>
+#endif
+
 #endif // !BOOST_HANA_EXT_STD_HPP
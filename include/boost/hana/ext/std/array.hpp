@@ -11,12 +11,24 @@ Distributed under the Boost Software License, Version 1.0.
 #define BOOST_HANA_EXT_STD_ARRAY_HPP
 
 #include <boost/hana/bool.hpp>
+#include <boost/hana/constant.hpp>
+#include <boost/hana/core/convert.hpp>
 #include <boost/hana/core/datatype.hpp>
 #include <boost/hana/core/models.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/std/common_type.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
 #include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
 #include <boost/hana/detail/std/move.hpp>
 #include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/functor.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/iterable.hpp>
+#include <boost/hana/logical.hpp>
 #include <boost/hana/sequence.hpp>
 
 #include <array>
@@ -49,25 +61,201 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     // Foldable
     //////////////////////////////////////////////////////////////////////////
+    namespace array_detail {
+        template <typename Xs>
+        using raw_t = typename detail::std::remove_reference<Xs>::type;
+
+        template <typename Xs>
+        using size = ::std::tuple_size<raw_t<Xs>>;
+
+        template <typename F, typename ...Args>
+        using result_t = typename detail::std::decay<decltype(
+            detail::std::declval<F&>()(detail::std::declval<Args>()...)
+        )>::type;
+
+        // Since all the elements of an array have the same type, a fold
+        // can be written as a plain loop whenever the accumulator keeps
+        // the type it has after the first step. This covers `sum` and
+        // `product`, whose initial state is an IntegralConstant but whose
+        // accumulator becomes a runtime number after the first step.
+        template <typename Xs, typename State, typename F,
+                  bool = (size<Xs>::value > 0)>
+        struct loops_left : detail::std::false_type { };
+
+        template <typename Xs, typename State, typename F>
+        struct loops_left<Xs, State, F, true> {
+            using T = typename raw_t<Xs>::value_type const&;
+            using Acc = result_t<F, State, T>;
+            static constexpr bool value = detail::std::is_same<
+                Acc, result_t<F, Acc, T>
+            >::value;
+        };
+
+        template <typename Xs, typename State, typename F,
+                  bool = (size<Xs>::value > 0)>
+        struct loops_right : detail::std::false_type { };
+
+        template <typename Xs, typename State, typename F>
+        struct loops_right<Xs, State, F, true> {
+            using T = typename raw_t<Xs>::value_type const&;
+            using Acc = result_t<F, T, State>;
+            static constexpr bool value = detail::std::is_same<
+                Acc, result_t<F, T, Acc>
+            >::value;
+        };
+    }
+
     template <>
-    struct fold_left_impl<ext::std::Array>
-        : Iterable::fold_left_impl<ext::std::Array>
-    { };
+    struct fold_left_impl<ext::std::Array> {
+        template <typename Xs, typename State, typename F>
+        static constexpr decltype(auto)
+        fold_helper(Xs&& xs, State&& state, F&& f, detail::std::false_type) {
+            return Iterable::fold_left_impl<ext::std::Array>::apply(
+                static_cast<Xs&&>(xs), static_cast<State&&>(state),
+                static_cast<F&&>(f)
+            );
+        }
+
+        template <typename T, std::size_t N, typename State, typename F>
+        static constexpr auto
+        fold_helper(::std::array<T, N> const& xs, State&& state, F&& f,
+                    detail::std::true_type)
+        {
+            auto acc = f(static_cast<State&&>(state), xs[0]);
+            for (std::size_t i = 1; i < N; ++i)
+                acc = f(detail::std::move(acc), xs[i]);
+            return acc;
+        }
+
+        template <typename Xs, typename State, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, State&& state, F&& f) {
+            using Loops = array_detail::loops_left<Xs, State&&, F>;
+            return fold_helper(static_cast<Xs&&>(xs),
+                               static_cast<State&&>(state),
+                               static_cast<F&&>(f),
+                               detail::std::integral_constant<bool, Loops::value>{});
+        }
+    };
 
     template <>
-    struct fold_right_impl<ext::std::Array>
-        : Iterable::fold_right_impl<ext::std::Array>
-    { };
+    struct fold_right_impl<ext::std::Array> {
+        template <typename Xs, typename State, typename F>
+        static constexpr decltype(auto)
+        fold_helper(Xs&& xs, State&& state, F&& f, detail::std::false_type) {
+            return Iterable::fold_right_impl<ext::std::Array>::apply(
+                static_cast<Xs&&>(xs), static_cast<State&&>(state),
+                static_cast<F&&>(f)
+            );
+        }
+
+        template <typename T, std::size_t N, typename State, typename F>
+        static constexpr auto
+        fold_helper(::std::array<T, N> const& xs, State&& state, F&& f,
+                    detail::std::true_type)
+        {
+            auto acc = f(xs[N - 1], static_cast<State&&>(state));
+            for (std::size_t i = N - 1; i-- > 0;)
+                acc = f(xs[i], detail::std::move(acc));
+            return acc;
+        }
+
+        template <typename Xs, typename State, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, State&& state, F&& f) {
+            using Loops = array_detail::loops_right<Xs, State&&, F>;
+            return fold_helper(static_cast<Xs&&>(xs),
+                               static_cast<State&&>(state),
+                               static_cast<F&&>(f),
+                               detail::std::integral_constant<bool, Loops::value>{});
+        }
+    };
 
     template <>
-    struct fold_left_nostate_impl<ext::std::Array>
-        : Iterable::fold_left_nostate_impl<ext::std::Array>
-    { };
+    struct fold_left_nostate_impl<ext::std::Array> {
+        template <typename Xs, typename F>
+        static constexpr decltype(auto)
+        fold_helper(Xs&& xs, F&& f, detail::std::false_type) {
+            return Iterable::fold_left_nostate_impl<ext::std::Array>::apply(
+                static_cast<Xs&&>(xs), static_cast<F&&>(f)
+            );
+        }
+
+        template <typename T, std::size_t N, typename F>
+        static constexpr auto
+        fold_helper(::std::array<T, N> const& xs, F&& f, detail::std::true_type) {
+            auto acc = f(xs[0], xs[1]);
+            for (std::size_t i = 2; i < N; ++i)
+                acc = f(detail::std::move(acc), xs[i]);
+            return acc;
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            using T = typename array_detail::raw_t<Xs>::value_type const&;
+            using Loops = array_detail::loops_left<Xs, T, F>;
+            return fold_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                detail::std::integral_constant<bool,
+                    (array_detail::size<Xs>::value > 1) && Loops::value
+                >{});
+        }
+    };
 
     template <>
-    struct fold_right_nostate_impl<ext::std::Array>
-        : Iterable::fold_right_nostate_impl<ext::std::Array>
-    { };
+    struct fold_right_nostate_impl<ext::std::Array> {
+        template <typename Xs, typename F>
+        static constexpr decltype(auto)
+        fold_helper(Xs&& xs, F&& f, detail::std::false_type) {
+            return Iterable::fold_right_nostate_impl<ext::std::Array>::apply(
+                static_cast<Xs&&>(xs), static_cast<F&&>(f)
+            );
+        }
+
+        template <typename T, std::size_t N, typename F>
+        static constexpr auto
+        fold_helper(::std::array<T, N> const& xs, F&& f, detail::std::true_type) {
+            auto acc = f(xs[N - 2], xs[N - 1]);
+            for (std::size_t i = N - 2; i-- > 0;)
+                acc = f(xs[i], detail::std::move(acc));
+            return acc;
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            using T = typename array_detail::raw_t<Xs>::value_type const&;
+            using Loops = array_detail::loops_right<Xs, T, F>;
+            return fold_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                detail::std::integral_constant<bool,
+                    (array_detail::size<Xs>::value > 1) && Loops::value
+                >{});
+        }
+    };
+
+    template <>
+    struct for_each_impl<ext::std::Array> {
+        template <typename T, std::size_t N, typename F>
+        static constexpr void apply(::std::array<T, N> const& xs, F&& f) {
+            for (std::size_t i = 0; i < N; ++i)
+                f(xs[i]);
+        }
+
+        template <typename T, std::size_t N, typename F>
+        static constexpr void apply(::std::array<T, N>& xs, F&& f) {
+            for (std::size_t i = 0; i < N; ++i)
+                f(xs[i]);
+        }
+
+        template <typename T, std::size_t N, typename F>
+        static constexpr void apply(::std::array<T, N>&& xs, F&& f) {
+            for (std::size_t i = 0; i < N; ++i)
+                f(detail::std::move(xs[i]));
+        }
+    };
+
+    template <>
+    struct length_impl<ext::std::Array> {
+        template <typename T, std::size_t N>
+        static constexpr auto apply(::std::array<T, N> const&)
+        { return size_t<N>; }
+    };
 
     //////////////////////////////////////////////////////////////////////////
     // Searchable
@@ -78,9 +266,39 @@ namespace boost { namespace hana {
     { };
 
     template <>
-    struct any_of_impl<ext::std::Array>
-        : Iterable::any_of_impl<ext::std::Array>
-    { };
+    struct any_of_impl<ext::std::Array> {
+        template <typename Xs, typename Pred>
+        static constexpr auto
+        any_of_helper(Xs&& xs, Pred&& pred, detail::std::true_type) {
+            return Iterable::any_of_impl<ext::std::Array>::apply(
+                static_cast<Xs&&>(xs), static_cast<Pred&&>(pred)
+            );
+        }
+
+        // When the predicate returns a runtime Logical, we stop at the
+        // first satisfying element with a plain loop.
+        template <typename T, std::size_t N, typename Pred>
+        static constexpr bool
+        any_of_helper(::std::array<T, N> const& xs, Pred&& pred,
+                      detail::std::false_type)
+        {
+            for (std::size_t i = 0; i < N; ++i)
+                if (hana::if_(pred(xs[i]), true, false))
+                    return true;
+            return false;
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&& pred) {
+            using T = typename array_detail::raw_t<Xs>::value_type const&;
+            using Result = decltype(pred(detail::std::declval<T>()));
+            constexpr bool is_constant = array_detail::size<Xs>::value == 0 ||
+                            _models<Constant, Result>{}();
+            return any_of_helper(static_cast<Xs&&>(xs),
+                                 static_cast<Pred&&>(pred),
+                                 detail::std::integral_constant<bool, is_constant>{});
+        }
+    };
 
     //////////////////////////////////////////////////////////////////////////
     // Iterable
@@ -127,6 +345,86 @@ namespace boost { namespace hana {
         static constexpr _integral_constant<bool, N == 0>
         apply(::std::array<T, N> const&) { return {}; }
     };
+
+    template <>
+    struct at_impl<ext::std::Array> {
+        template <typename Xs, typename N>
+        static constexpr decltype(auto) apply(Xs&& xs, N const&) {
+            constexpr std::size_t n = hana::value<N>();
+            return ::std::get<n>(static_cast<Xs&&>(xs));
+        }
+    };
+
+    template <>
+    struct random_access<ext::std::Array>
+        : _integral_constant<bool, true>
+    { };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct transform_impl<ext::std::Array> {
+        template <typename T, std::size_t N, typename F, std::size_t ...i>
+        static constexpr auto
+        transform_helper(::std::array<T, N> const& xs, F&& f,
+                         detail::std::index_sequence<i...>)
+        {
+            using U = array_detail::result_t<F, T const&>;
+            return ::std::array<U, N>{{f(xs[i])...}};
+        }
+
+        template <typename Xs, typename F>
+        static constexpr auto apply(Xs&& xs, F&& f) {
+            return transform_helper(xs, static_cast<F&&>(f),
+                detail::std::make_index_sequence<array_detail::size<Xs>::value>{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Conversion from a Foldable
+    //////////////////////////////////////////////////////////////////////////
+    namespace array_detail {
+        template <typename T, typename ...Ts>
+        struct common { using type = T; };
+
+        template <typename T, typename U, typename ...Ts>
+        struct common<T, U, Ts...>
+            : common<typename detail::std::common_type<T, U>::type, Ts...>
+        { };
+
+        struct make_array {
+            template <typename X, typename ...Xs>
+            constexpr auto operator()(X&& x, Xs&& ...xs) const {
+                using T = typename common<
+                    typename detail::std::decay<X>::type,
+                    typename detail::std::decay<Xs>::type...
+                >::type;
+                return ::std::array<T, sizeof...(Xs) + 1>{{
+                    static_cast<T>(static_cast<X&&>(x)),
+                    static_cast<T>(static_cast<Xs&&>(xs))...
+                }};
+            }
+
+            // There are no elements to deduce the type of the elements of
+            // the std::array from.
+            template <typename ...Nothing>
+            constexpr void operator()(Nothing&& ...) const {
+                static_assert(sizeof...(Nothing) != 0,
+                "hana::to<ext::std::Array> can't deduce the type of the elements "
+                "of the std::array when converting an empty structure");
+            }
+        };
+    }
+
+    template <typename F>
+    struct to_impl<ext::std::Array, F, when<_models<Foldable, F>{}()>> {
+        template <typename Xs>
+        static constexpr auto apply(Xs&& xs) {
+            return hana::unpack(static_cast<Xs&&>(xs),
+                                array_detail::make_array{});
+        }
+    };
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_EXT_STD_ARRAY_HPP
@@ -0,0 +1,43 @@
+/*!
+@file
+Defines the floating point placeholders of `boost::hana::format`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXT_STD_FORMAT_HPP
+#define BOOST_HANA_EXT_STD_FORMAT_HPP
+
+#include <boost/hana/format.hpp>
+
+#include <cstdio>
+
+
+namespace boost { namespace hana { namespace format_detail {
+    template <>
+    struct write_floating_point<double> {
+        static void apply(sink& out, double x) {
+            char digits[32];
+            int n = ::std::snprintf(digits, sizeof(digits), "%g", x);
+            out.append(digits, static_cast< ::std::size_t>(n));
+        }
+    };
+
+    template <>
+    struct write_floating_point<float>
+        : write_floating_point<double>
+    { };
+
+    template <>
+    struct write_floating_point<long double> {
+        static void apply(sink& out, long double x) {
+            char digits[48];
+            int n = ::std::snprintf(digits, sizeof(digits), "%Lg", x);
+            out.append(digits, static_cast< ::std::size_t>(n));
+        }
+    };
+}}} // end namespace boost::hana::format_detail
+
+#endif // !BOOST_HANA_EXT_STD_FORMAT_HPP
@@ -14,6 +14,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/comparable.hpp>
 #include <boost/hana/core/datatype.hpp>
 #include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
 #include <boost/hana/ext/std/integral_constant.hpp>
 #include <boost/hana/foldable.hpp>
 #include <boost/hana/iterable.hpp>
@@ -69,6 +70,13 @@ namespace boost { namespace hana {
         }
     };
 
+    template <>
+    struct length_impl<ext::std::IntegerSequence> {
+        template <typename T, T ...v>
+        static constexpr auto apply(::std::integer_sequence<T, v...> const&)
+        { return size_t<sizeof...(v)>; }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Searchable
     //////////////////////////////////////////////////////////////////////////
@@ -105,6 +113,21 @@ namespace boost { namespace hana {
         static constexpr auto apply(::std::integer_sequence<T, xs...>)
         { return bool_<sizeof...(xs) == 0>; }
     };
+
+    template <>
+    struct at_impl<ext::std::IntegerSequence> {
+        template <typename T, T ...v, typename N>
+        static constexpr auto apply(::std::integer_sequence<T, v...>, N const&) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            constexpr T values[] = {v...};
+            return ::std::integral_constant<T, values[n]>{};
+        }
+    };
+
+    template <>
+    struct random_access<ext::std::IntegerSequence>
+        : _integral_constant<bool, true>
+    { };
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_EXT_STD_INTEGER_SEQUENCE_HPP
@@ -0,0 +1,36 @@
+/*!
+@file
+Defines the conversion of `boost::hana::String` to `std::string_view`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXT_STD_STRING_VIEW_HPP
+#define BOOST_HANA_EXT_STD_STRING_VIEW_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/convert.hpp>
+#include <boost/hana/string.hpp>
+
+
+#ifndef BOOST_HANA_CONFIG_HAS_STD_STRING_VIEW
+#   error The conversion of Strings to std::string_view requires the        \
+          <string_view> header, which is only available in C++1z.
+#endif
+
+#include <string_view>
+
+
+namespace boost { namespace hana {
+    template <>
+    struct to_impl< ::std::string_view, String> {
+        template <char ...c>
+        static constexpr ::std::string_view apply(_string<c...> const&) {
+            return {to_impl<char const*, String>::c_string<c...>, sizeof...(c)};
+        }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_EXT_STD_STRING_VIEW_HPP
@@ -19,7 +19,9 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/std/integer_sequence.hpp>
 #include <boost/hana/detail/std/remove_reference.hpp>
 #include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/foldable.hpp>
 #include <boost/hana/functor.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/iterable.hpp>
 #include <boost/hana/monad.hpp>
 #include <boost/hana/monad_plus.hpp>
@@ -138,6 +140,16 @@ namespace boost { namespace hana {
         { return ::std::tuple<>{}; }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct length_impl<ext::std::Tuple> {
+        template <typename ...Xs>
+        static constexpr auto apply(::std::tuple<Xs...> const&)
+        { return size_t<sizeof...(Xs)>; }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Iterable
     //////////////////////////////////////////////////////////////////////////
@@ -186,6 +198,11 @@ namespace boost { namespace hana {
         }
     };
 
+    template <>
+    struct random_access<ext::std::Tuple>
+        : _integral_constant<bool, true>
+    { };
+
     //////////////////////////////////////////////////////////////////////////
     // Sequence
     //////////////////////////////////////////////////////////////////////////
@@ -19,12 +19,16 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/when.hpp>
 #include <boost/hana/detail/by.hpp> // needed by xxx.by
+#include <boost/hana/detail/closure.hpp>
 #include <boost/hana/detail/create.hpp>
+#include <boost/hana/detail/jump_table.hpp>
 #include <boost/hana/detail/std/decay.hpp>
 #include <boost/hana/detail/std/integer_sequence.hpp>
 #include <boost/hana/detail/std/is_same.hpp>
 #include <boost/hana/detail/std/move.hpp>
+#include <boost/hana/detail/std/remove_reference.hpp>
 #include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/variadic/fold_balanced.hpp>
 #include <boost/hana/detail/variadic/foldl1.hpp>
 #include <boost/hana/detail/variadic/foldr1.hpp>
 #include <boost/hana/detail/variadic/for_each.hpp>
@@ -178,6 +182,64 @@ namespace boost { namespace hana {
         : foldable_detail::foldr1_helper<T>, default_
     { };
 
+    //////////////////////////////////////////////////////////////////////////
+    // fold.balanced (with state)
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T, typename>
+    struct fold_balanced_impl : fold_balanced_impl<T, when<true>> { };
+
+    namespace foldable_detail {
+        // The state is combined with the result of folding the structure,
+        // so the structure itself is folded with `fold.balanced(xs, f)`.
+        template <bool empty>
+        struct fold_balanced_helper {
+            template <typename Xs, typename S, typename F>
+            static constexpr auto apply(Xs&&, S&& s, F&&)
+            { return static_cast<S&&>(s); }
+        };
+
+        template <>
+        struct fold_balanced_helper<false> {
+            template <typename Xs, typename S, typename F>
+            static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+                return f(static_cast<S&&>(s),
+                         hana::fold.balanced(static_cast<Xs&&>(xs), f));
+            }
+        };
+    }
+
+    template <typename T, bool condition>
+    struct fold_balanced_impl<T, when<condition>> : default_ {
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            constexpr bool empty = hana::value<decltype(hana::length(xs))>() == 0;
+            return foldable_detail::fold_balanced_helper<empty>::apply(
+                static_cast<Xs&&>(xs), static_cast<S&&>(s), static_cast<F&&>(f)
+            );
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // fold.balanced (without state)
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T, typename>
+    struct fold_balanced_nostate_impl
+        : fold_balanced_nostate_impl<T, when<true>>
+    { };
+
+    template <typename T, bool condition>
+    struct fold_balanced_nostate_impl<T, when<condition>> : default_ {
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            static_assert(hana::value<decltype(hana::length(xs))>() != 0,
+            "hana::fold.balanced(xs, f) requires xs to be non-empty");
+            return hana::unpack(static_cast<Xs&&>(xs),
+                hana::partial(detail::variadic::fold_balanced,
+                              static_cast<F&&>(f))
+            );
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // monadic_fold.left (with state)
     //////////////////////////////////////////////////////////////////////////
@@ -377,6 +439,76 @@ namespace boost { namespace hana {
         : foldable_detail::for_each_helper<T>, default_
     { };
 
+    //////////////////////////////////////////////////////////////////////////
+    // visit_at
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T, typename>
+    struct visit_at_impl : visit_at_impl<T, when<true>> { };
+
+    namespace foldable_detail {
+        template <typename F>
+        struct ignore_index {
+            F& f;
+            template <typename N, typename X>
+            constexpr decltype(auto) operator()(N const&, X&& x) const
+            { return f(static_cast<X&&>(x)); }
+        };
+    }
+
+    template <typename T, bool condition>
+    struct visit_at_impl<T, when<condition>> : default_ {
+        template <typename Xs, typename F, typename Fallback>
+        static constexpr decltype(auto)
+        apply(Xs&& xs, detail::std::size_t i, F&& f, Fallback&& fallback) {
+            return hana::visit_at.with_index(static_cast<Xs&&>(xs), i,
+                foldable_detail::ignore_index<F>{f},
+                static_cast<Fallback&&>(fallback)
+            );
+        }
+    };
+
+    template <typename T, typename>
+    struct visit_at_with_index_impl : visit_at_with_index_impl<T, when<true>> { };
+
+    namespace foldable_detail {
+        struct get_pointee {
+            template <detail::std::size_t n, typename Ptrs>
+            static constexpr decltype(auto) apply(Ptrs&& ptrs)
+            { return *detail::get<n>(ptrs); }
+        };
+
+        // Unpacked elements are only available as function arguments, so
+        // the jump table accesses them through a closure of pointers.
+        template <typename F, typename Fallback>
+        struct visit_at_pointers {
+            detail::std::size_t i;
+            F& f;
+            Fallback& fallback;
+
+            template <typename ...X>
+            constexpr decltype(auto) operator()(X&& ...x) const {
+                using Ptrs = detail::closure<
+                    typename detail::std::remove_reference<X>::type*...
+                >;
+                Ptrs ptrs{&x...};
+                return detail::jump_table<get_pointee, Ptrs, F, Fallback,
+                    detail::std::make_index_sequence<sizeof...(X)>
+                >::apply(ptrs, i, f, fallback);
+            }
+        };
+    }
+
+    template <typename T, bool condition>
+    struct visit_at_with_index_impl<T, when<condition>> : default_ {
+        template <typename Xs, typename F, typename Fallback>
+        static constexpr decltype(auto)
+        apply(Xs&& xs, detail::std::size_t i, F&& f, Fallback&& fallback) {
+            return hana::unpack(static_cast<Xs&&>(xs),
+                foldable_detail::visit_at_pointers<F, Fallback>{i, f, fallback}
+            );
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // length
     //////////////////////////////////////////////////////////////////////////
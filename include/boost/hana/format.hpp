@@ -0,0 +1,234 @@
+/*!
+@file
+Defines `boost::hana::format`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FORMAT_HPP
+#define BOOST_HANA_FORMAT_HPP
+
+#include <boost/hana/fwd/format.hpp>
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/detail/constexpr/array.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/enable_if.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_floating_point.hpp>
+#include <boost/hana/detail/std/is_integral.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/wrong.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+
+namespace boost { namespace hana {
+    namespace format_detail {
+        // Appends characters to a buffer ending at `last`. The characters
+        // which do not fit are dropped, but they are still counted.
+        struct sink {
+            char* out;
+            char* last;
+            detail::std::size_t count;
+
+            void append(char const* s, detail::std::size_t n) {
+                detail::std::size_t room = static_cast<detail::std::size_t>(last - out);
+                detail::std::size_t written = n < room ? n : room;
+                for (detail::std::size_t i = 0; i < written; ++i)
+                    *out++ = s[i];
+                count += n;
+            }
+        };
+
+        template <typename T, typename = void>
+        struct write_value {
+            static_assert(detail::wrong<write_value<T>>{},
+            "hana::format does not know how to write placeholders of this type");
+        };
+
+        template <>
+        struct write_value<char> {
+            static void apply(sink& out, char c)
+            { out.append(&c, 1); }
+        };
+
+        template <>
+        struct write_value<bool> {
+            static void apply(sink& out, bool b)
+            { out.append(b ? "1" : "0", 1); }
+        };
+
+        template <typename T>
+        struct write_value<T, typename detail::std::enable_if<
+            detail::std::is_integral<T>::value &&
+            !detail::std::is_same<T, char>::value &&
+            !detail::std::is_same<T, bool>::value
+        >::type> {
+            static void apply(sink& out, T x) {
+                // Digits are computed from the end, and on the negative side
+                // for negative numbers, so that the most negative value does
+                // not overflow.
+                char digits[3 * sizeof(T) + 1];
+                char* first = digits + sizeof(digits);
+                bool negative = x < 0;
+                do {
+                    T digit = x % 10;
+                    *--first = static_cast<char>('0' + (negative ? -digit : digit));
+                    x /= 10;
+                } while (x != 0);
+                if (negative)
+                    *--first = '-';
+                out.append(first, static_cast<detail::std::size_t>(
+                                        digits + sizeof(digits) - first));
+            }
+        };
+
+        // Floating point numbers are written with `std::snprintf`, which
+        // is provided by the <boost/hana/ext/std/format.hpp> header.
+        template <typename T>
+        struct write_floating_point {
+            static_assert(detail::wrong<write_floating_point<T>>{},
+            "hana::format requires <boost/hana/ext/std/format.hpp> to be "
+            "included to write floating point placeholders");
+        };
+
+        template <typename T>
+        struct write_value<T, typename detail::std::enable_if<
+            detail::std::is_floating_point<T>::value
+        >::type>
+            : write_floating_point<T>
+        { };
+
+        template <>
+        struct write_value<char const*> {
+            static void apply(sink& out, char const* s) {
+                detail::std::size_t n = 0;
+                while (s[n] != '\0')
+                    ++n;
+                out.append(s, n);
+            }
+        };
+
+        template <char ...s, detail::std::size_t n, typename Args>
+        void write_token(sink& out, _string<s...> const&,
+                         detail::std::integral_constant<detail::std::size_t, n>,
+                         Args const&)
+        {
+            out.append(to_impl<char const*, String>::c_string<s...>,
+                       sizeof...(s));
+        }
+
+        template <typename T, detail::std::size_t n, typename Args>
+        void write_token(sink& out, _type<T> const&,
+                         detail::std::integral_constant<detail::std::size_t, n>,
+                         Args const& args)
+        {
+            write_value<T>::apply(out, hana::at_c<n>(args));
+        }
+
+        template <typename Token>
+        constexpr bool is_token() {
+            using D = typename datatype<Token>::type;
+            return detail::std::is_same<D, String>::value ||
+                   detail::std::is_same<D, Type>::value;
+        }
+
+        template <typename ...Tokens>
+        constexpr bool are_tokens() {
+            bool tokens[] = {is_token<Tokens>()..., true};
+            for (detail::std::size_t i = 0; i < sizeof...(Tokens); ++i)
+                if (!tokens[i])
+                    return false;
+            return true;
+        }
+
+        template <typename Token>
+        constexpr bool is_placeholder() {
+            using D = typename datatype<Token>::type;
+            return detail::std::is_same<D, Type>::value;
+        }
+
+        // The index of the argument consumed by each placeholder, and the
+        // total number of arguments.
+        template <typename ...Tokens>
+        struct arguments {
+            static constexpr detail::std::size_t N = sizeof...(Tokens);
+
+            using index_t = detail::constexpr_::array<detail::std::size_t, N + 1>;
+
+            static constexpr index_t compute() {
+                bool placeholders[] = {is_placeholder<Tokens>()..., false};
+                index_t result{};
+                for (detail::std::size_t i = 0; i < N; ++i)
+                    result[i + 1] = result[i] + placeholders[i];
+                return result;
+            }
+
+            static constexpr index_t index = compute();
+
+            static constexpr detail::std::size_t count = index[N];
+        };
+
+        template <typename ...Tokens>
+        constexpr typename arguments<Tokens...>::index_t arguments<Tokens...>::index;
+
+        template <typename ...Tokens>
+        constexpr detail::std::size_t arguments<Tokens...>::count;
+    }
+
+    template <typename ...Tokens>
+    struct _formatter {
+        using Arguments = format_detail::arguments<Tokens...>;
+
+        template <typename Args, detail::std::size_t ...i>
+        static void write_all(format_detail::sink& out, Args const& args,
+                              detail::std::index_sequence<i...>)
+        {
+            int expand[] = {0, (format_detail::write_token(out, Tokens{},
+                detail::std::integral_constant<
+                    detail::std::size_t, Arguments::index[i]
+                >{},
+                args
+            ), 0)...};
+            (void)expand;
+        }
+
+        template <typename ...Args>
+        detail::std::size_t
+        operator()(char* buffer, detail::std::size_t size, Args const& ...args) const {
+            static_assert(sizeof...(Args) == Arguments::count,
+            "hana::format(tokens...)(buffer, size, args...) requires as many "
+            "arguments as there are placeholders in the tokens");
+
+            format_detail::sink out{buffer, buffer + (size == 0 ? 0 : size - 1), 0};
+            write_all(out, hana::tie(args...),
+                      detail::std::make_index_sequence<sizeof...(Tokens)>{});
+            if (size != 0)
+                *out.out = '\0';
+            return out.count;
+        }
+    };
+
+    //! @cond
+    template <typename ...Tokens>
+    constexpr auto _format::operator()(Tokens const& ...) const {
+        // The tokens are validated here rather than when the result is
+        // called, so that an invalid format is diagnosed even if unused.
+        static_assert(format_detail::are_tokens<
+            typename detail::std::decay<Tokens>::type...
+        >(),
+        "hana::format(tokens...) requires each token to be a String or a Type");
+
+        return _formatter<typename detail::std::decay<Tokens>::type...>{};
+    }
+    //! @endcond
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_FORMAT_HPP
@@ -193,20 +193,21 @@ namespace boost { namespace hana {
 
         template <typename ...X>
         constexpr decltype(auto) operator()(X&& ...x) const& {
-            return f(static_cast<G const&>(g).get(x...)...);
+            return f(detail::get(static_cast<G const&>(g))(x...)...);
         }
 
 #ifndef BOOST_HANA_CONFIG_CONSTEXPR_MEMBER_FUNCTION_IS_CONST
         template <typename ...X>
         constexpr decltype(auto) operator()(X&& ...x) & {
-            return f(static_cast<G&>(g).get(x...)...);
+            return f(detail::get(static_cast<G&>(g))(x...)...);
         }
 #endif
 
         template <typename ...X>
         constexpr decltype(auto) operator()(X&& ...x) && {
             // Not moving from G cause we would double-move.
-            return detail::std::move(f)(static_cast<G&>(g).get(x...)...);
+            return detail::std::move(f)(
+                                detail::get(static_cast<G&>(g))(x...)...);
         }
     };
 
@@ -54,20 +54,22 @@ namespace boost { namespace hana {
 
         template <typename ...Y>
         constexpr decltype(auto) operator()(Y&& ...y) const& {
-            return f(static_cast<X const&>(x).get..., static_cast<Y&&>(y)...);
+            return f(detail::get(static_cast<X const&>(x))...,
+                     static_cast<Y&&>(y)...);
         }
 
 #ifndef BOOST_HANA_CONFIG_CONSTEXPR_MEMBER_FUNCTION_IS_CONST
         template <typename ...Y>
         constexpr decltype(auto) operator()(Y&& ...y) & {
-            return f(static_cast<X&>(x).get..., static_cast<Y&&>(y)...);
+            return f(detail::get(static_cast<X&>(x))...,
+                     static_cast<Y&&>(y)...);
         }
 #endif
 
         template <typename ...Y>
         constexpr decltype(auto) operator()(Y&& ...y) && {
             return detail::std::move(f)(
-                static_cast<X&&>(x).get..., static_cast<Y&&>(y)...
+                detail::get(static_cast<X&&>(x))..., static_cast<Y&&>(y)...
             );
         }
     };
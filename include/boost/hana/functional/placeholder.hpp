@@ -99,25 +99,29 @@ namespace boost { namespace hana {
 
             template <typename F, typename ...Z>
             constexpr auto operator()(F&& f, Z const& ...) const&
-                -> decltype(static_cast<F&&>(f)(static_cast<X const&>(
-                    detail::std::declval<detail::closure_impl<X...>>()
-                ).get...))
-            { return static_cast<F&&>(f)(static_cast<X const&>(x).get...); }
+                -> decltype(static_cast<F&&>(f)(detail::get(
+                    static_cast<X const&>(
+                        detail::std::declval<detail::closure_impl<X...>>())
+                )...))
+            { return static_cast<F&&>(f)(
+                                    detail::get(static_cast<X const&>(x))...); }
 
 #ifndef BOOST_HANA_CONFIG_CONSTEXPR_MEMBER_FUNCTION_IS_CONST
             template <typename F, typename ...Z>
             constexpr auto operator()(F&& f, Z const& ...) &
-                -> decltype(static_cast<F&&>(f)(static_cast<X&>(
-                    detail::std::declval<detail::closure_impl<X...>&>()
-                ).get...))
-            { return static_cast<F&&>(f)(static_cast<X&>(x).get...); }
+                -> decltype(static_cast<F&&>(f)(detail::get(
+                    static_cast<X&>(
+                        detail::std::declval<detail::closure_impl<X...>&>())
+                )...))
+            { return static_cast<F&&>(f)(detail::get(static_cast<X&>(x))...); }
 
             template <typename F, typename ...Z>
             constexpr auto operator()(F&& f, Z const& ...) &&
-                -> decltype(static_cast<F&&>(f)(static_cast<X&&>(
-                    detail::std::declval<detail::closure_impl<X...>>()
-                ).get...))
-            { return static_cast<F&&>(f)(static_cast<X&&>(x).get...); }
+                -> decltype(static_cast<F&&>(f)(detail::get(
+                    static_cast<X&&>(
+                        detail::std::declval<detail::closure_impl<X...>>())
+                )...))
+            { return static_cast<F&&>(f)(detail::get(static_cast<X&&>(x))...); }
 #endif
         };
 
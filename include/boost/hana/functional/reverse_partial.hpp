@@ -53,20 +53,22 @@ namespace boost { namespace hana {
 
         template <typename ...Y>
         constexpr decltype(auto) operator()(Y&& ...y) const& {
-            return f(static_cast<Y&&>(y)..., static_cast<X const&>(x).get...);
+            return f(static_cast<Y&&>(y)...,
+                     detail::get(static_cast<X const&>(x))...);
         }
 
 #ifndef BOOST_HANA_CONFIG_CONSTEXPR_MEMBER_FUNCTION_IS_CONST
         template <typename ...Y>
         constexpr decltype(auto) operator()(Y&& ...y) & {
-            return f(static_cast<Y&&>(y)..., static_cast<X&>(x).get...);
+            return f(static_cast<Y&&>(y)...,
+                     detail::get(static_cast<X&>(x))...);
         }
 #endif
 
         template <typename ...Y>
         constexpr decltype(auto) operator()(Y&& ...y) && {
             return detail::std::move(f)(
-                static_cast<Y&&>(y)..., static_cast<X&&>(x).get...
+                static_cast<Y&&>(y)..., detail::get(static_cast<X&&>(x))...
             );
         }
     };
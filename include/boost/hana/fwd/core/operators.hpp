@@ -75,6 +75,18 @@ namespace boost { namespace hana {
         //! @include example/core/operators.cpp
         struct adl { };
 
+        //! @ingroup group-details
+        //! Equivalent to `operators::adl`, but parameterized by the type
+        //! inheriting from it.
+        //!
+        //! Since distinct types inherit from distinct specializations of
+        //! this template, several of them can be empty bases of the same
+        //! object without having to live at different addresses. Hana's
+        //! own types use this so that empty objects take no space when they
+        //! are nested inside each other.
+        template <typename T>
+        struct adl_for { };
+
         //! @ingroup group-core
         //! Controls the operator aliases that are enabled for a data type.
         //!
@@ -13,6 +13,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/detail/by_fwd.hpp>
 #include <boost/hana/detail/dispatch_if.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
 #include <boost/hana/functional/curry.hpp>
 #include <boost/hana/functional/flip.hpp>
 #include <boost/hana/fwd/core/datatype.hpp>
@@ -136,6 +137,9 @@ namespace boost { namespace hana {
     //!
     //!     fold.right(xs, state, f) = see below
     //!     fold.right(xs, f) = see below
+    //!
+    //!     fold.balanced(xs, state, f) = see below
+    //!     fold.balanced(xs, f) = see below
     //! @endcode
     //!
     //! In the above, `xs` is always the structure to be folded. Similarly,
@@ -239,6 +243,56 @@ namespace boost { namespace hana {
     //! @snippet example/foldable.cpp fold.right
     //!
     //!
+    //! ## Balanced folds (`fold.balanced`)
+    //! `fold.balanced` folds a structure with an associative binary
+    //! operation by combining its adjacent elements pairwise, and then
+    //! combining the results pairwise until a single value is left. Given a
+    //! structure containing `x1, ..., xn`, a function `f` and optionally an
+    //! initial state, `fold.balanced` applies `f` as follows
+    //! @code
+    //!     f(f(f(x1, x2), f(x3, x4)), ... f(xn-1, xn) ...) // without state
+    //!     f(state, fold.balanced(xs, f))                  // with state
+    //! @endcode
+    //!
+    //! When `f` is associative, this is equivalent to `fold.left` and
+    //! `fold.right`. However, the calls to `f` are only nested `log2(n)`
+    //! levels deep, instead of `n` levels deep. This makes it possible to
+    //! fold long structures without hitting the recursion limits of the
+    //! compiler, and it makes the resulting code easier to inline. When `f`
+    //! is not associative, the result of `fold.balanced` is unspecified.
+    //!
+    //! ### Signature
+    //! Given a `Foldable` `xs` of data type `F(T)`, an associative function
+    //! \f$ f : T \times T \to T \f$ and an initial state `s` of data type
+    //! `T`, the signatures for `fold.balanced` are
+    //! \f[
+    //!     \mathrm{fold.balanced} : F(T) \times T \times (T \times T \to T) \to T
+    //! \f]
+    //!
+    //! for the variant with an initial state, and
+    //! \f[
+    //!     \mathrm{fold.balanced} : F(T) \times (T \times T \to T) \to T
+    //! \f]
+    //!
+    //! for the variant without an initial state.
+    //!
+    //! @param xs
+    //! The structure to fold.
+    //!
+    //! @param state
+    //! The initial value used for folding. It is returned as-is when the
+    //! structure is empty, and it is combined with the result of folding
+    //! the structure otherwise.
+    //!
+    //! @param f
+    //! An associative binary function called as `f(x, y)`, where `x` and
+    //! `y` are elements of the structure or results of previous calls to
+    //! `f`.
+    //!
+    //! ### Example
+    //! @snippet example/foldable.cpp fold.balanced
+    //!
+    //!
     //! ## Tag-dispatching
     //! All of the different fold variants are tag-dispatched methods
     //! and can be overridden individually. Here is how each variant is
@@ -249,6 +303,9 @@ namespace boost { namespace hana {
     //!
     //!     fold.right(xs, state, f) -> fold_right_impl<Xs>::apply(xs, state, f)
     //!     fold.right(xs, f)        -> fold_right_nostate_impl<Xs>::apply(xs, f)
+    //!
+    //!     fold.balanced(xs, state, f) -> fold_balanced_impl<Xs>::apply(xs, state, f)
+    //!     fold.balanced(xs, f)        -> fold_balanced_nostate_impl<Xs>::apply(xs, f)
     //! @endcode
     //! `fold` is not tag-dispatched because it is just an alias to `fold.left`.
     //!
@@ -278,6 +335,12 @@ namespace boost { namespace hana {
     template <typename Xs, typename = void>
     struct fold_right_nostate_impl;
 
+    template <typename Xs, typename = void>
+    struct fold_balanced_impl;
+
+    template <typename Xs, typename = void>
+    struct fold_balanced_nostate_impl;
+
 
     struct _fold_left {
         template <typename Xs, typename State, typename F>
@@ -347,15 +410,53 @@ namespace boost { namespace hana {
         }
     };
 
+    struct _fold_balanced {
+        template <typename Xs, typename State, typename F>
+        constexpr decltype(auto) operator()(Xs&& xs, State&& state, F&& f) const {
+            using S = typename datatype<Xs>::type;
+            using FoldBalanced = BOOST_HANA_DISPATCH_IF(fold_balanced_impl<S>,
+                _models<Foldable, S>{}()
+            );
+
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(_models<Foldable, S>{},
+            "hana::fold.balanced(xs, state, f) requires xs to be Foldable");
+        #endif
+
+            return FoldBalanced::apply(static_cast<Xs&&>(xs),
+                                       static_cast<State&&>(state),
+                                       static_cast<F&&>(f));
+        }
+
+        template <typename Xs, typename F>
+        constexpr decltype(auto) operator()(Xs&& xs, F&& f) const {
+            using S = typename datatype<Xs>::type;
+            using FoldBalanced = BOOST_HANA_DISPATCH_IF(fold_balanced_nostate_impl<S>,
+                _models<Foldable, S>{}()
+            );
+
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(_models<Foldable, S>{},
+            "hana::fold.balanced(xs, f) requires xs to be Foldable");
+        #endif
+
+            return FoldBalanced::apply(static_cast<Xs&&>(xs),
+                                       static_cast<F&&>(f));
+        }
+    };
+
     template <typename ...AvoidODRViolation>
     struct _fold : _fold_left {
         static constexpr _fold_left left{};
         static constexpr _fold_right right{};
+        static constexpr _fold_balanced balanced{};
     };
     template <typename ...AvoidODRViolation>
     constexpr _fold_left _fold<AvoidODRViolation...>::left;
     template <typename ...AvoidODRViolation>
     constexpr _fold_right _fold<AvoidODRViolation...>::right;
+    template <typename ...AvoidODRViolation>
+    constexpr _fold_balanced _fold<AvoidODRViolation...>::balanced;
 
     constexpr _fold<> fold{};
 #endif
@@ -731,6 +832,114 @@ namespace boost { namespace hana {
     constexpr _for_each for_each{};
 #endif
 
+    //! Call a function on the element of a structure at a runtime index.
+    //! @relates Foldable
+    //!
+    //! Given a `Foldable` structure `xs` with a linearization of
+    //! `[x1, ..., xn]`, a runtime index `i`, a function `f` and a
+    //! nullary function `fallback`, `visit_at(xs, i, f, fallback)`
+    //! returns `f(x(i+1))` if `i < n`, and `fallback()` otherwise.
+    //! This allows selecting an element of a heterogeneous structure with
+    //! an index only known at runtime, without writing a `switch` by hand.
+    //! The call to `f` is dispatched with a single indirect call through a
+    //! table of function pointers generated at compile-time.
+    //!
+    //! The result of `visit_at` has the type of `fallback()`, and the result
+    //! of `f` must be convertible to that type for each element. When the
+    //! index of the element is also needed, `visit_at.with_index(xs, i, f,
+    //! fallback)` calls `f(size_t<i>, x(i+1))` instead, where `size_t<i>`
+    //! is the index of the element as a compile-time constant.
+    //!
+    //!
+    //! @param xs
+    //! The structure containing the element to visit.
+    //!
+    //! @param i
+    //! The 0-based index of the element to visit, as a `std::size_t`.
+    //!
+    //! @param f
+    //! A function called as `f(x)`, or `f(size_t<i>, x)` with `with_index`,
+    //! where `x` is the element at index `i`. When possible, `x` is a
+    //! reference to the element in the structure.
+    //!
+    //! @param fallback
+    //! A nullary function called when the index is out of the bounds of the
+    //! structure.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/foldable.cpp visit_at
+    //!
+    //!
+    //! Tag-dispatching
+    //! ---------------
+    //! @code
+    //!     visit_at(xs, i, f, fallback) -> visit_at_impl<Xs>::apply(xs, i, f, fallback)
+    //!     visit_at.with_index(xs, i, f, fallback) -> visit_at_with_index_impl<Xs>::apply(xs, i, f, fallback)
+    //! @endcode
+    //! By default, `visit_at` is implemented with `visit_at.with_index`,
+    //! which is implemented with `unpack`.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto visit_at = see documentation;
+#else
+    template <typename Xs, typename = void>
+    struct visit_at_impl;
+
+    template <typename Xs, typename = void>
+    struct visit_at_with_index_impl;
+
+    struct _visit_at_with_index {
+        template <typename Xs, typename F, typename Fallback>
+        constexpr decltype(auto) operator()(Xs&& xs, detail::std::size_t i,
+                                            F&& f, Fallback&& fallback) const
+        {
+            using S = typename datatype<Xs>::type;
+            using VisitAtWithIndex = BOOST_HANA_DISPATCH_IF(
+                visit_at_with_index_impl<S>,
+                _models<Foldable, S>{}()
+            );
+
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(_models<Foldable, S>{},
+            "hana::visit_at.with_index(xs, i, f, fallback) requires xs to be Foldable");
+        #endif
+
+            return VisitAtWithIndex::apply(static_cast<Xs&&>(xs), i,
+                                           static_cast<F&&>(f),
+                                           static_cast<Fallback&&>(fallback));
+        }
+    };
+
+    template <typename ...AvoidODRViolation>
+    struct _visit_at {
+        static constexpr _visit_at_with_index with_index{};
+
+        template <typename Xs, typename F, typename Fallback>
+        constexpr decltype(auto) operator()(Xs&& xs, detail::std::size_t i,
+                                            F&& f, Fallback&& fallback) const
+        {
+            using S = typename datatype<Xs>::type;
+            using VisitAt = BOOST_HANA_DISPATCH_IF(visit_at_impl<S>,
+                _models<Foldable, S>{}()
+            );
+
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(_models<Foldable, S>{},
+            "hana::visit_at(xs, i, f, fallback) requires xs to be Foldable");
+        #endif
+
+            return VisitAt::apply(static_cast<Xs&&>(xs), i,
+                                  static_cast<F&&>(f),
+                                  static_cast<Fallback&&>(fallback));
+        }
+    };
+    template <typename ...AvoidODRViolation>
+    constexpr _visit_at_with_index _visit_at<AvoidODRViolation...>::with_index;
+
+    constexpr _visit_at<> visit_at{};
+#endif
+
     //! Return the number of elements in a finite structure.
     //! @relates Foldable
     //!
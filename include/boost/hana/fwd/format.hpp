@@ -0,0 +1,67 @@
+/*!
+@file
+Forward declares `boost::hana::format`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_FORMAT_HPP
+#define BOOST_HANA_FWD_FORMAT_HPP
+
+namespace boost { namespace hana {
+    //! @relatesalso boost::hana::String
+    //! Compile a sequence of `String`s and typed placeholders into a function
+    //! writing formatted text to a buffer.
+    //!
+    //! Given tokens which are either `String`s or `Type`s, `format(tokens...)`
+    //! returns a function object `f` such that `f(buffer, size, args...)`
+    //! writes the tokens in order to the `buffer` of `size` characters. Each
+    //! `String` is written as-is, and each `type<T>` is a placeholder which
+    //! consumes the next argument in `args...`, converts it to `T` and writes
+    //! it. Like `std::snprintf`, `f` writes at most `size - 1` characters
+    //! followed by a null character, and it returns the number of characters
+    //! which would have been written if `size` had been large enough, not
+    //! counting the null character.
+    //!
+    //! Unlike `std::snprintf`, there is no format string to parse at runtime.
+    //! The lengths of the literal segments are known at compile-time, and
+    //! the function writing each placeholder is selected at compile-time
+    //! from its type. The following placeholder types are supported:
+    //! - `char`, which is written as a character
+    //! - `bool`, which is written as `1` or `0`
+    //! - all the other integral types, which are written in decimal
+    //! - `char const*`, which is written up to its null character
+    //! - floating point types, which are written like `%g` does, but only
+    //!   when the `boost/hana/ext/std/format.hpp` header is included, since
+    //!   this is done with `std::snprintf`
+    //!
+    //! A hard compile-time error is triggered if a token is neither a
+    //! `String` nor a `Type`, or if the number of arguments does not match
+    //! the number of placeholders.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/format.cpp main
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto format = [](auto const& ...tokens) {
+        return [](char* buffer, std::size_t size, auto const& ...args) -> std::size_t {
+            return see documentation;
+        };
+    };
+#else
+    template <typename ...Tokens>
+    struct _formatter;
+
+    struct _format {
+        template <typename ...Tokens>
+        constexpr auto operator()(Tokens const& ...tokens) const;
+    };
+
+    constexpr _format format{};
+#endif
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_FWD_FORMAT_HPP
@@ -161,7 +161,9 @@ namespace boost { namespace hana {
     }
 
     template <typename T, T v>
-    struct _integral_constant : operators::adl {
+    struct _integral_constant
+        : operators::adl_for<_integral_constant<T, v>>
+    {
         // std::integral_constant interface
         using type = _integral_constant;
         using value_type = T;
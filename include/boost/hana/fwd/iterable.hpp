@@ -87,6 +87,17 @@ namespace boost { namespace hana {
     //! `head`, `tail` and `is_empty`
     //!
     //!
+    //! Random access
+    //! -------------
+    //! By default, `at`, `last` and `drop` walk the structure with `tail`,
+    //! one element at a time. An `Iterable` can declare that it supports
+    //! random access by specializing the `random_access` trait. For such
+    //! `Iterable`s, `last` and `find_if` access the elements by index
+    //! directly. If the `Iterable` is also a `Sequence`, `drop` and `slice`
+    //! create the resulting sequence directly from the elements at the
+    //! right indices.
+    //!
+    //!
     //! Superclasses
     //! ------------
     //! 1. `Searchable` (free model)\n
@@ -199,6 +210,30 @@ namespace boost { namespace hana {
         template <typename It> struct any_of_impl;
     };
 
+    //! Trait telling whether an `Iterable` supports random access.
+    //! @relates Iterable
+    //!
+    //! `random_access<It>` is a boolean `IntegralConstant` telling whether
+    //! the `Iterable`s of data type `It` can be accessed efficiently by
+    //! index. It is false unless it is specialized, because an `Iterable`
+    //! must opt-in explicitly by making its specialization inherit from
+    //! `decltype(true_)`. Only do so when both `at` and `length` are
+    //! provided without walking the structure; otherwise, the default
+    //! implementations of `last`, `drop`, `slice` and `find_if` would be
+    //! quadratic instead of linear.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/iterable.cpp random_access
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <typename It>
+    struct random_access { see documentation };
+#else
+    template <typename It, typename = void>
+    struct random_access;
+#endif
+
     //! Returns the first element of a non-empty iterable.
     //! @relates Iterable
     //!
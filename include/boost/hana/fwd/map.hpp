@@ -25,6 +25,11 @@ namespace boost { namespace hana {
     //! keys must be comparable with each other and that comparison must
     //! yield a compile-time `Logical`.
     //!
+    //! Keys that are `Type`s, `IntegralConstant`s or `String`s are looked
+    //! up by their type instead of being compared with each key of the map
+    //! in turn, which keeps the compile-time cost of `at_key`, `find` and
+    //! `contains` independent of the size of the map.
+    //!
     //!
     //! Modeled concepts
     //! ----------------
@@ -188,7 +188,7 @@ namespace boost { namespace hana {
 #ifdef BOOST_HANA_DOXYGEN_INVOKED
     constexpr unspecified-type nothing{};
 #else
-    struct _nothing : operators::adl {
+    struct _nothing : operators::adl_for<_nothing> {
         static constexpr bool is_just = false;
         struct hana { using datatype = Optional; };
     };
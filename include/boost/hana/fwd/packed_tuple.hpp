@@ -0,0 +1,73 @@
+/*!
+@file
+Forward declares `boost::hana::PackedTuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_PACKED_TUPLE_HPP
+#define BOOST_HANA_FWD_PACKED_TUPLE_HPP
+
+#include <boost/hana/fwd/core/make.hpp>
+
+
+namespace boost { namespace hana {
+    //! @ingroup group-datatypes
+    //! General purpose index-based sequence with a padding-minimizing layout.
+    //!
+    //! A `PackedTuple` behaves exactly like a `Tuple`, except for the way
+    //! its elements are laid out in memory. While a `Tuple` stores its
+    //! elements in the order in which they are given, a `PackedTuple`
+    //! stores them by decreasing alignment, which minimizes the padding
+    //! required between them. For example, on a typical 64 bits platform,
+    //! @code
+    //!     sizeof(_tuple<char, double, char, int>)        == 24
+    //!     sizeof(_packed_tuple<char, double, char, int>) == 16
+    //! @endcode
+    //!
+    //! The reordering only affects the storage; the logical order of the
+    //! elements is preserved by all the methods, including `at` and
+    //! `unpack`. Elements with the same alignment keep their relative
+    //! order in the storage. This makes `PackedTuple` a good choice for
+    //! storing a large number of small heterogeneous records, at the cost
+    //! of a layout which is not predictable from the declaration alone.
+    //!
+    //!
+    //! Modeled concepts
+    //! ----------------
+    //! `PackedTuple` is a model of the `Sequence` concept, and all the
+    //! concepts it refines. See the documentation of `Tuple` for examples.
+    //!
+    //! @snippet example/packed_tuple.cpp main
+    struct PackedTuple { };
+
+    template <typename ...Xs>
+    struct _packed_tuple;
+
+    //! Function object for creating a `PackedTuple`.
+    //! @relates PackedTuple
+    //!
+    //! Given zero or more objects `xs...`, `make<PackedTuple>` returns a new
+    //! `PackedTuple` containing those objects. The elements are held by
+    //! value inside the resulting packed tuple, and they are hence copied
+    //! or moved in.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/packed_tuple.cpp make<PackedTuple>
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <>
+    constexpr auto make<PackedTuple> = [](auto&& ...xs) {
+        return _packed_tuple<std::decay_t<decltype(xs)>...>{forwarded(xs)...};
+    };
+#endif
+
+    //! Alias to `make<PackedTuple>`; provided for convenience.
+    //! @relates PackedTuple
+    constexpr auto make_packed_tuple = make<PackedTuple>;
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_FWD_PACKED_TUPLE_HPP
@@ -22,6 +22,22 @@ namespace boost { namespace hana {
     //! where a tuple would be too much, like returning two elements from a
     //! function.
     //!
+    //! Unlike `std::pair`, the elements of a `Pair` can't be accessed as
+    //! `p.first` and `p.second`; they must be accessed with the `first`
+    //! and `second` methods of the `Product` concept. This is because the
+    //! elements are held in a way that allows empty objects, like the
+    //! `Type` keys of a `Map`, to take no space inside the pair.
+    //!
+    //! > #### Note on the removed `first` and `second` data members
+    //! > Previous versions of `_pair` had public `first` and `second` data
+    //! > members. These were removed when the elements started being held
+    //! > as base classes whenever they are empty, since a data member always
+    //! > takes at least one byte. Code using them must be changed as follows:
+    //! > @code
+    //! >     p.first   // becomes hana::first(p)
+    //! >     p.second  // becomes hana::second(p)
+    //! > @endcode
+    //!
     //!
     //! Modeled concepts
     //! ----------------
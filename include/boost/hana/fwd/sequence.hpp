@@ -216,6 +216,113 @@ namespace boost { namespace hana {
         template <typename S> struct traverse_impl;
     };
 
+    //! Returns the permutation of indices that would sort a sequence,
+    //! optionally based on a custom `predicate`.
+    //! @relates Sequence
+    //!
+    //! Given a Sequence `xs` and an optional predicate (by default `less`),
+    //! `argsort` returns a sequence of `size_t`s `[i1, ..., in]` such that
+    //! `[xs[i1], ..., xs[in]]` is the same as `sort(xs, predicate)`. Like
+    //! `sort`, `argsort` is stable; the indices of elements that are neither
+    //! less nor greater than each other appear in increasing order.
+    //!
+    //! This is useful to sort a sequence without moving its elements, or to
+    //! apply the same permutation to several sequences.
+    //!
+    //!
+    //! Signature
+    //! ---------
+    //! Given a `Sequence` `S(T)`, a `Logical` `Bool` and a binary predicate
+    //! \f$ T \times T \to Bool \f$, `argsort` has the following signatures.
+    //! For the variant with a provided predicate,
+    //! \f[
+    //!     \mathrm{argsort} : S(T) \times (T \times T \to Bool) \to S(\mathrm{size\_t})
+    //! \f]
+    //!
+    //! for the variant without a custom predicate, the `T` data type is
+    //! required to be `Orderable`. The signature is then
+    //! \f[
+    //!     \mathrm{argsort} : S(T) \to S(\mathrm{size\_t})
+    //! \f]
+    //!
+    //! @param xs
+    //! The sequence whose sorted permutation is computed.
+    //!
+    //! @param predicate
+    //! A function called as `predicate(x, y)` for two elements `x` and `y` of
+    //! the sequence, with the same requirements as the predicate of `sort`.
+    //! In particular, it must return a `Constant Logical`. When the predicate
+    //! is not specified, this defaults to `less`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/sequence.cpp argsort
+    //!
+    //!
+    //! Syntactic sugar (`argsort.by`)
+    //! ------------------------------
+    //! Like `sort`, `argsort` can be called as
+    //! @code
+    //!     argsort.by(predicate, xs) == argsort(xs, predicate)
+    //!     argsort.by(predicate) == argsort(-, predicate)
+    //! @endcode
+    //!
+    //!
+    //! Tag dispatching
+    //! ---------------
+    //! Both versions of `argsort` are tag-dispatched methods:
+    //! @code
+    //!     argsort(xs) -> argsort_impl<data type of xs>::apply(xs)
+    //!     argsort(xs, pred) -> argsort_pred_impl<data type of xs>::apply(xs, pred)
+    //! @endcode
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto argsort = [](auto&& xs[, auto&& predicate]) {
+        return tag-dispatched;
+    };
+#else
+    template <typename S, typename = void>
+    struct argsort_impl;
+
+    template <typename S, typename = void>
+    struct argsort_pred_impl;
+
+    struct _argsort : detail::by<_argsort> {
+        template <typename Xs>
+        constexpr decltype(auto) operator()(Xs&& xs) const {
+            using S = typename datatype<Xs>::type;
+            using Argsort = BOOST_HANA_DISPATCH_IF(argsort_impl<S>,
+                _models<Sequence, S>{}()
+            );
+
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(_models<Sequence, S>{},
+            "hana::argsort(xs) requires 'xs' to be a Sequence");
+        #endif
+
+            return Argsort::apply(static_cast<Xs&&>(xs));
+        }
+
+        template <typename Xs, typename Predicate>
+        constexpr decltype(auto) operator()(Xs&& xs, Predicate&& pred) const {
+            using S = typename datatype<Xs>::type;
+            using Argsort = BOOST_HANA_DISPATCH_IF(argsort_pred_impl<S>,
+                _models<Sequence, S>{}()
+            );
+
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(_models<Sequence, S>{},
+            "hana::argsort(xs, predicate) requires 'xs' to be a Sequence");
+        #endif
+
+            return Argsort::apply(static_cast<Xs&&>(xs),
+                                  static_cast<Predicate&&>(pred));
+        }
+    };
+
+    constexpr _argsort argsort{};
+#endif
+
     //! Computes the cartesian product of a sequence of sequences.
     //! @relates Sequence
     //!
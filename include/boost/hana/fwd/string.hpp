@@ -23,11 +23,13 @@ namespace boost { namespace hana {
     //! single generalized type.
     //!
     //! `String`s are used for simple purposes like being keys in a `Map` or
-    //! tagging the members of a `Struct`. However, you might find that
-    //! `String` does not provide enough functionality to be used as a
-    //! full-blown compile-time string implementation. Indeed, providing
-    //! a comprehensive string interface is a lot of job, and it is out
-    //! of the scope of the library for the time being.
+    //! tagging the members of a `Struct`. A few substring algorithms like
+    //! `find_substring`, `split`, `replace_substring` and `string_join` are
+    //! also provided. However, you might find that `String` does not provide
+    //! enough functionality to be used as a full-blown compile-time string
+    //! implementation. Indeed, providing a comprehensive string interface
+    //! is a lot of job, and it is out of the scope of the library for the
+    //! time being.
     //!
     //!
     //! Modeled concepts
@@ -70,6 +72,15 @@ namespace boost { namespace hana {
     //! model the same concepts as `String` does.
     //! @snippet example/string.cpp to<char const*>
     //!
+    //! The resulting pointer refers to a static array shared by all the
+    //! `String`s of the same type. Since the length of a `String` is known
+    //! at compile-time through `length`, there is never a need to call
+    //! `std::strlen` on it. When `std::string_view` is available, which
+    //! requires C++1z, including the `boost/hana/ext/std/string_view.hpp`
+    //! header also provides `to<std::string_view>`, a `constexpr` view of
+    //! that array with the length of the `String`.
+    //! @snippet example/string.cpp to<std::string_view>
+    //!
     //!
     //! > #### Rationale for `String` not being a `Constant`
     //! > The underlying type held by a `String` could be either `char const*`
@@ -107,6 +118,11 @@ namespace boost { namespace hana {
     //! compile-time strings. However, since this macro uses a lambda
     //! internally, it can't be used in an unevaluated context.
     //!
+    //! The characters of the literal are expanded through an index sequence.
+    //! When the compiler provides a builtin to create integer sequences,
+    //! this is done without any recursive instantiation, so long literals
+    //! of several kilobytes remain cheap to create.
+    //!
     //!
     //! Example
     //! -------
@@ -123,6 +139,242 @@ namespace boost { namespace hana {
     // defined in <boost/hana/string.hpp>
 #endif
 
+    //! Find the position of the first occurrence of a substring in a `String`.
+    //! @relates String
+    //!
+    //! Given two `String`s `s` and `sub`, `find_substring(s, sub)` returns
+    //! `just(size_t<i>)`, where `i` is the position of the first occurrence
+    //! of `sub` in `s`, or `nothing` if `sub` does not appear in `s`. An
+    //! empty `sub` is found at position `0`.
+    //!
+    //! Like the other substring algorithms on `String`s, the positions are
+    //! computed by a single `constexpr` pass over the characters of the
+    //! strings, instead of recursing on each character. Hence, these
+    //! algorithms stay cheap to compile even for long strings.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/string.cpp find_substring
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto find_substring = [](auto const& s, auto const& sub) {
+        return see documentation;
+    };
+#else
+    struct _find_substring {
+        template <char ...s, char ...sub>
+        constexpr auto operator()(_string<s...> const&,
+                                  _string<sub...> const&) const;
+    };
+
+    constexpr _find_substring find_substring{};
+#endif
+
+    //! Returns whether a `String` starts with another `String`.
+    //! @relates String
+    //!
+    //! `starts_with(s, prefix)` is a boolean `IntegralConstant` which is
+    //! true if and only if the first characters of `s` are those of `prefix`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/string.cpp starts_with
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto starts_with = [](auto const& s, auto const& prefix) {
+        return see documentation;
+    };
+#else
+    struct _starts_with {
+        template <char ...s, char ...prefix>
+        constexpr auto operator()(_string<s...> const&,
+                                  _string<prefix...> const&) const;
+    };
+
+    constexpr _starts_with starts_with{};
+#endif
+
+    //! Returns whether a `String` ends with another `String`.
+    //! @relates String
+    //!
+    //! `ends_with(s, suffix)` is a boolean `IntegralConstant` which is
+    //! true if and only if the last characters of `s` are those of `suffix`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/string.cpp ends_with
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto ends_with = [](auto const& s, auto const& suffix) {
+        return see documentation;
+    };
+#else
+    struct _ends_with {
+        template <char ...s, char ...suffix>
+        constexpr auto operator()(_string<s...> const&,
+                                  _string<suffix...> const&) const;
+    };
+
+    constexpr _ends_with ends_with{};
+#endif
+
+    //! Split a `String` into the `Tuple` of its pieces delimited by a
+    //! separator.
+    //! @relates String
+    //!
+    //! Given a `String` `s` and a non-empty `String` `sep`, `split(s, sep)`
+    //! returns a `Tuple` of the `String`s found between the occurrences of
+    //! `sep` in `s`, searched from left to right. Like `str.split(sep)` in
+    //! Python, the result has one more element than there are occurrences
+    //! of `sep`, some of which may be empty. In particular, `split` is the
+    //! inverse of `string_join`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/string.cpp split
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto split = [](auto const& s, auto const& sep) {
+        return see documentation;
+    };
+#else
+    struct _split {
+        template <char ...s, char ...sep>
+        constexpr auto operator()(_string<s...> const&,
+                                  _string<sep...> const&) const;
+    };
+
+    constexpr _split split{};
+#endif
+
+    //! Replace the occurrences of a substring in a `String`.
+    //! @relates String
+    //!
+    //! Given a `String` `s` and two `String`s `from` and `to`, with `from`
+    //! non-empty, `replace_substring(s, from, to)` is the `String` obtained
+    //! by replacing every occurrence of `from` in `s` by `to`. Occurrences
+    //! are searched from left to right and do not overlap. Note that this
+    //! is unrelated to `replace`, which replaces elements of a `Functor`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/string.cpp replace_substring
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto replace_substring = [](auto const& s, auto const& from, auto const& to) {
+        return see documentation;
+    };
+#else
+    struct _replace_substring {
+        template <char ...s, char ...from, char ...to>
+        constexpr auto operator()(_string<s...> const&,
+                                  _string<from...> const&,
+                                  _string<to...> const&) const;
+    };
+
+    constexpr _replace_substring replace_substring{};
+#endif
+
+    //! Concatenate any number of `String`s.
+    //! @relates String
+    //!
+    //! `string_concat(s1, ..., sn)` is the `String` made of the characters
+    //! of `s1`, ..., `sn`, in this order, and `string_concat()` is the empty
+    //! `String`. The result is built in a single step. By contrast, folding
+    //! the strings with a binary concatenation creates one intermediate
+    //! `String` per step. To concatenate the `String`s held in a `Foldable`
+    //! `xs`, use `unpack(xs, string_concat)`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/string.cpp string_concat
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto string_concat = [](auto const& ...strings) {
+        return see documentation;
+    };
+#else
+    struct _string_concat {
+        template <typename ...Strings>
+        constexpr auto operator()(Strings const& ...strings) const;
+    };
+
+    constexpr _string_concat string_concat{};
+#endif
+
+    //! Concatenate a sequence of `String`s, inserting a separator between
+    //! them.
+    //! @relates String
+    //!
+    //! Given a `Foldable` `strings` containing `String`s and a `String`
+    //! `sep`, `string_join(strings, sep)` is the `String` made of the
+    //! elements of `strings` in order, with `sep` inserted between each of
+    //! them. The result is built in a single step, without creating a
+    //! `String` for each intermediate concatenation. This is not named
+    //! `join` to avoid any confusion with the operation of a `Monad` known
+    //! under that name, which is called `flatten` in Hana.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/string.cpp string_join
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto string_join = [](auto const& strings, auto const& sep) {
+        return see documentation;
+    };
+#else
+    struct _string_join {
+        template <typename Strings, char ...sep>
+        constexpr auto operator()(Strings const& strings,
+                                  _string<sep...> const&) const;
+    };
+
+    constexpr _string_join string_join{};
+#endif
+
+    //! Create a function dispatching on a runtime string using a compile-time
+    //! perfect hash of the keys of a map.
+    //! @relates String
+    //!
+    //! Given a `Foldable` `map` of `Product`s whose first components are
+    //! `String`s, such as a `Map` from `String`s to handlers, `string_switch`
+    //! returns a function object `sw` such that `sw(s, length, f, fallback)`
+    //! is equivalent to `f(second(p))`, where `p` is the pair of `map`
+    //! whose key is equal to the first `length` characters pointed to by
+    //! `s`. If no key is equal to the runtime string, `fallback()` is
+    //! returned instead. For convenience, `sw(s, f, fallback)` is also
+    //! provided for objects with `s.data()` and `s.size()` methods, such as
+    //! `std::string`. Like for `visit_at`, the result of every call to `f`
+    //! must be convertible to the type of `fallback()`. When `p` is a `Pair`,
+    //! `f` receives a reference to its second component instead of a copy.
+    //!
+    //! A perfect hash function over the keys is built at compile-time, so
+    //! that a lookup hashes the runtime string once, reads two small tables
+    //! to find the only key which could match, and compares the runtime
+    //! string with that key only. Unlike a chain of string comparisons, the cost of a
+    //! lookup does not depend on the number of keys. A hard compile-time
+    //! error is triggered if the keys are not distinct `String`s.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/string.cpp string_switch
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto string_switch = [](auto&& map) {
+        return [perfect-hash-of-keys, map](auto const& s, std::size_t length,
+                                           auto&& f, auto&& fallback) {
+            return see documentation;
+        };
+    };
+#else
+    struct _string_switch {
+        template <typename Map>
+        constexpr auto operator()(Map&& map) const;
+    };
+
+    constexpr _string_switch string_switch{};
+#endif
+
 #ifdef BOOST_HANA_CONFIG_ENABLE_STRING_UDL
     namespace literals {
         //! Creates a compile-time `String` from a string literal.
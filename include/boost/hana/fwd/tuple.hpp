@@ -31,6 +31,13 @@ namespace boost { namespace hana {
     //! sequence with a key-based access, then you should consider the
     //! `Map` and `Set` data types instead.
     //!
+    //! A `Tuple` is trivially copyable, trivially destructible and trivially
+    //! default constructible whenever all of its elements are. Hence, tuples
+    //! of such elements can be copied with `std::memcpy`, and containers
+    //! like `std::vector` can relocate them in bulk. However, since the
+    //! elements are stored in distinct base classes, a `Tuple` with more
+    //! than one element is never a standard-layout type.
+    //!
     //!
     //! Modeled concepts
     //! ----------------
@@ -71,6 +78,69 @@ namespace boost { namespace hana {
     //! @relates Tuple
     constexpr auto make_tuple = make<Tuple>;
 
+    //! Create a `Tuple` of lvalue references to the given objects.
+    //! @relates Tuple
+    //!
+    //! Given zero or more lvalues `xs...`, `tie` returns a `Tuple` holding
+    //! references to them. This is analogous to `std::tie`; in particular,
+    //! assigning a `Tuple` of the same length to the result assigns each of
+    //! its elements to the corresponding referred-to object. The algorithms
+    //! returning a subsequence of a `Tuple`, such as `filter`, `partition`,
+    //! `slice`, `take`, `drop`, `remove_at` and `reverse`, preserve the
+    //! lvalue references held by it. Hence, such a tuple can be used as a
+    //! view to reorganize objects without ever copying them. A view over
+    //! the elements of an existing tuple `xs` is obtained with
+    //! `unpack(xs, tie)`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/tuple.cpp tie
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto tie = [](auto& ...xs) -> _tuple<decltype(xs)...> {
+        return {xs...};
+    };
+#else
+    struct _tie {
+        template <typename ...Xs>
+        constexpr _tuple<Xs&...> operator()(Xs& ...xs) const
+        { return {xs...}; }
+    };
+
+    constexpr _tie tie{};
+#endif
+
+    //! Create a `Tuple` of references to the given objects, preserving their
+    //! value category.
+    //! @relates Tuple
+    //!
+    //! Given zero or more objects `xs...`, `forward_as_tuple` returns a
+    //! `Tuple` holding an lvalue reference to each lvalue and an rvalue
+    //! reference to each rvalue. This is analogous to `std::forward_as_tuple`,
+    //! and it is useful to pass arguments through `unpack` without copying
+    //! them. Like temporaries bound to references, the rvalues referred to
+    //! by the resulting tuple must outlive it.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/tuple.cpp forward_as_tuple
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto forward_as_tuple = [](auto&& ...xs)
+        -> _tuple<decltype(xs)&&...>
+    {
+        return {forwarded(xs)...};
+    };
+#else
+    struct _forward_as_tuple {
+        template <typename ...Xs>
+        constexpr _tuple<Xs&&...> operator()(Xs&& ...xs) const
+        { return {static_cast<Xs&&>(xs)...}; }
+    };
+
+    constexpr _forward_as_tuple forward_as_tuple{};
+#endif
+
     //! Create a `Tuple` specialized for holding `Type`s.
     //! @relates Tuple
     //!
@@ -0,0 +1,242 @@
+/*!
+@file
+Forward declares `boost::hana::View`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_VIEW_HPP
+#define BOOST_HANA_FWD_VIEW_HPP
+
+#include <boost/hana/detail/std/size_t.hpp>
+
+
+namespace boost { namespace hana {
+    //! @ingroup group-datatypes
+    //! Tag representing a lazy, read-only sequence whose elements are
+    //! computed on demand.
+    //!
+    //! A `View` has a length known at compile-time, but its elements are
+    //! only created when they are accessed. Hence, only the elements that
+    //! are actually visited are ever instantiated, which makes it possible
+    //! to work with sequences that would be too large to materialize, like
+    //! the permutations of a tuple.
+    //!
+    //! Views are created by functions like `transform_view`, `filter_view`
+    //! or `permutations_view`; there is no `make<View>`. To materialize a
+    //! `View`, use `to<Tuple>`. A `View` created from an lvalue sequence
+    //! refers to that sequence instead of copying it, and its elements are
+    //! then returned by reference whenever possible. Hence, composing views
+    //! never copies the underlying elements, but such a `View` must not
+    //! outlive the sequence it refers to. A `View` created from an rvalue
+    //! sequence holds that sequence by value.
+    //!
+    //!
+    //! Modeled concepts
+    //! ----------------
+    //! 1. `Foldable`\n
+    //! Folding a `View` is equivalent to folding the sequence of its
+    //! elements. `for_each` creates the elements one at a time.
+    //!
+    //! 2. `Iterable` (operators provided)\n
+    //! Accessing the `n`th element of a `View` only computes that element.
+    //! Taking the `tail` of a `View` or dropping elements from it returns
+    //! another `View`, without computing any element.
+    //!
+    //! 3. `Searchable`\n
+    //! Searching a `View` with a compile-time predicate stops as soon as
+    //! an element satisfying the predicate is found, and the elements past
+    //! that point are never instantiated.
+    struct View { };
+
+    template <typename Impl, detail::std::size_t from, detail::std::size_t to>
+    struct _view;
+
+    //! Returns the `n`th permutation of a sequence, in lexicographical
+    //! order.
+    //! @relates View
+    //!
+    //! Given a sequence `xs` of length `k` and an index `n < k!`,
+    //! `nth_permutation<n>(xs)` is a sequence of the same data type
+    //! containing the elements of `xs` in the same order as the `n`th
+    //! element of `permutations(xs)`. The permutation is computed directly
+    //! from the Lehmer code of `n`, so the other permutations are never
+    //! created.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/view.cpp nth_permutation
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <std::size_t n>
+    constexpr auto nth_permutation = [](auto&& xs) {
+        return the-nth-permutation-of-xs;
+    };
+#else
+    template <detail::std::size_t n>
+    struct _nth_permutation {
+        template <typename Xs>
+        constexpr auto operator()(Xs const& xs) const;
+    };
+
+    template <detail::std::size_t n>
+    constexpr _nth_permutation<n> nth_permutation{};
+#endif
+
+    //! Returns a `View` of all the permutations of a sequence.
+    //! @relates View
+    //!
+    //! `permutations_view(xs)` contains the same elements as
+    //! `permutations(xs)`, in lexicographical order of the positions of
+    //! the elements in `xs`. However, the permutations are only created
+    //! when they are accessed. In particular, `find_if` and `any_of` only
+    //! create the permutations up to the first one satisfying the predicate,
+    //! and `for_each` creates them one at a time.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/view.cpp permutations_view
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto permutations_view = [](auto&& xs) {
+        return unspecified-type;
+    };
+#else
+    struct _permutations_view {
+        template <typename Xs>
+        constexpr auto operator()(Xs&& xs) const;
+    };
+
+    constexpr _permutations_view permutations_view{};
+#endif
+
+    //! Returns a `View` of the cartesian product of a sequence of sequences.
+    //! @relates View
+    //!
+    //! `cartesian_product_view(xs)` contains the same elements as
+    //! `cartesian_product(xs)`, in the same order. However, each combination
+    //! is only created when it is accessed, by computing the positions of
+    //! its elements from its index in the product. Hence, iterating over
+    //! the product with `for_each` never holds more than one combination at
+    //! a time, and `find_if` stops at the first matching combination.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/view.cpp cartesian_product_view
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto cartesian_product_view = [](auto&& xs) {
+        return unspecified-type;
+    };
+#else
+    struct _cartesian_product_view {
+        template <typename Xs>
+        constexpr auto operator()(Xs&& xs) const;
+    };
+
+    constexpr _cartesian_product_view cartesian_product_view{};
+#endif
+
+    //! Returns a `View` of the result of applying a function to each
+    //! element of a sequence.
+    //! @relates View
+    //!
+    //! `transform_view(xs, f)` contains the same elements as
+    //! `transform(xs, f)`, but `f` is only applied to an element when that
+    //! element of the view is accessed, and it is applied again each time
+    //! the element is accessed.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/view.cpp transform_view
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto transform_view = [](auto&& xs, auto&& f) {
+        return unspecified-type;
+    };
+#else
+    struct _transform_view {
+        template <typename Xs, typename F>
+        constexpr auto operator()(Xs&& xs, F&& f) const;
+    };
+
+    constexpr _transform_view transform_view{};
+#endif
+
+    //! Returns a `View` of the elements of a sequence satisfying a
+    //! compile-time predicate.
+    //! @relates View
+    //!
+    //! `filter_view(xs, pred)` contains the same elements as
+    //! `filter(xs, pred)`. The positions of the elements satisfying the
+    //! predicate are computed at compile-time from the types of the
+    //! elements, so the predicate is never called at runtime and no element
+    //! is copied.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/view.cpp filter_view
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto filter_view = [](auto&& xs, auto&& pred) {
+        return unspecified-type;
+    };
+#else
+    struct _filter_view {
+        template <typename Xs, typename Pred>
+        constexpr auto operator()(Xs&& xs, Pred&&) const;
+    };
+
+    constexpr _filter_view filter_view{};
+#endif
+
+    //! Returns a `View` of the elements of a sequence in the half-open
+    //! range of positions `[from, to)`.
+    //! @relates View
+    //!
+    //! `slice_view(xs, from, to)` contains the same elements as
+    //! `slice(xs, from, to)`, where `from` and `to` are non-negative
+    //! `Constant`s such that `from <= to <= length(xs)`. Slicing a `View`
+    //! returns another `View` over the same underlying sequence.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/view.cpp slice_view
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto slice_view = [](auto&& xs, auto const& from, auto const& to) {
+        return unspecified-type;
+    };
+#else
+    struct _slice_view {
+        template <typename Xs, typename From, typename To>
+        constexpr auto operator()(Xs&& xs, From const&, To const&) const;
+    };
+
+    constexpr _slice_view slice_view{};
+#endif
+
+    //! Returns a `View` of the elements of a sequence in reverse order.
+    //! @relates View
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/view.cpp reverse_view
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto reverse_view = [](auto&& xs) {
+        return unspecified-type;
+    };
+#else
+    struct _reverse_view {
+        template <typename Xs>
+        constexpr auto operator()(Xs&& xs) const;
+    };
+
+    constexpr _reverse_view reverse_view{};
+#endif
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_FWD_VIEW_HPP
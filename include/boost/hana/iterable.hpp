@@ -17,9 +17,11 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/datatype.hpp>
 #include <boost/hana/core/default.hpp>
+#include <boost/hana/core/make.hpp>
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/operators.hpp>
 #include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
 #include <boost/hana/detail/std/size_t.hpp>
 #include <boost/hana/enumerable.hpp>
 #include <boost/hana/foldable.hpp>
@@ -28,6 +30,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/functional/iterate.hpp>
 #include <boost/hana/functional/lockstep.hpp>
 #include <boost/hana/functional/partial.hpp>
+#include <boost/hana/fwd/sequence.hpp>
 #include <boost/hana/integral_constant.hpp>
 #include <boost/hana/lazy.hpp>
 #include <boost/hana/logical.hpp>
@@ -141,22 +144,76 @@ namespace boost { namespace hana {
         { return hana::at(static_cast<Xs&&>(xs), size_t<n>); }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Random access
+    //////////////////////////////////////////////////////////////////////////
+    template <typename It, typename>
+    struct random_access : random_access<It, when<true>> { };
+
+    template <typename It, bool condition>
+    struct random_access<It, when<condition>>
+        : _integral_constant<bool, false>
+    { };
+
+    namespace iterable_detail {
+        // For `Iterable`s supporting random access, the default
+        // implementations of `last`, `drop`, `slice` and `find_if` use
+        // `at` and `length` to access the elements directly by index,
+        // instead of walking the structure with `tail`.
+        template <typename It>
+        struct random_access_sequence
+            : _integral_constant<bool,
+                random_access<It>{}() && _models<Sequence, It>{}()
+            >
+        { };
+
+        // Creates a sequence of data type `S` with the elements of `xs`
+        // at the indices `from + i...`.
+        template <typename S, detail::std::size_t from>
+        struct make_from_indices {
+            template <typename Xs, detail::std::size_t ...i>
+            static constexpr auto
+            apply(Xs&& xs, detail::std::index_sequence<i...>) {
+                return hana::make<S>(
+                    hana::at(static_cast<Xs&&>(xs), size_t<from + i>)...
+                );
+            }
+        };
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // last
     //////////////////////////////////////////////////////////////////////////
     template <typename It, typename>
     struct last_impl : last_impl<It, when<true>> { };
 
+    namespace iterable_detail {
+        template <typename It, bool = random_access<It>{}()>
+        struct last_helper {
+            template <typename Xs>
+            static constexpr auto apply(Xs xs) {
+                return hana::eval_if(hana::is_empty(hana::tail(xs)),
+                    hana::always(hana::head(xs)),
+                    hana::lazy(hana::compose(last, tail))(xs)
+                );
+            }
+        };
+
+        template <typename It>
+        struct last_helper<It, true> {
+            template <typename Xs>
+            static constexpr decltype(auto) apply(Xs&& xs) {
+                constexpr detail::std::size_t n =
+                    hana::value<decltype(hana::length(xs))>();
+                return hana::at(static_cast<Xs&&>(xs), size_t<n - 1>);
+            }
+        };
+    }
+
     template <typename It, bool condition>
-    struct last_impl<It, when<condition>> : default_ {
-        template <typename Xs>
-        static constexpr auto apply(Xs xs) {
-            return hana::eval_if(hana::is_empty(hana::tail(xs)),
-                hana::always(hana::head(xs)),
-                hana::lazy(hana::compose(last, tail))(xs)
-            );
-        }
-    };
+    struct last_impl<It, when<condition>>
+        : iterable_detail::last_helper<It>, default_
+    { };
 
     //////////////////////////////////////////////////////////////////////////
     // drop.at_most
@@ -164,18 +221,40 @@ namespace boost { namespace hana {
     template <typename It, typename>
     struct drop_at_most_impl : drop_at_most_impl<It, when<true>> { };
 
+    namespace iterable_detail {
+        template <typename It, bool = random_access_sequence<It>{}()>
+        struct drop_at_most_helper {
+            template <typename Xs, typename N>
+            static constexpr auto apply(Xs&& xs, N&& n) {
+                using I = typename datatype<N>::type;
+                return hana::eval_if(
+                    hana::or_(hana::equal(n, zero<I>()), hana::is_empty(xs)),
+                    hana::always(xs),
+                    hana::lazy(hana::lockstep(drop.at_most)(tail, pred))(xs, n)
+                );
+            }
+        };
+
+        template <typename It>
+        struct drop_at_most_helper<It, true> {
+            template <typename Xs, typename N>
+            static constexpr auto apply(Xs&& xs, N const&) {
+                constexpr detail::std::size_t n = hana::value<N>();
+                constexpr detail::std::size_t len =
+                    hana::value<decltype(hana::length(xs))>();
+                constexpr detail::std::size_t start = n < len ? n : len;
+                return make_from_indices<It, start>::apply(
+                    static_cast<Xs&&>(xs),
+                    detail::std::make_index_sequence<len - start>{}
+                );
+            }
+        };
+    }
+
     template <typename It, bool condition>
-    struct drop_at_most_impl<It, when<condition>> : default_ {
-        template <typename Xs, typename N>
-        static constexpr auto apply(Xs&& xs, N&& n) {
-            using I = typename datatype<N>::type;
-            return hana::eval_if(
-                hana::or_(hana::equal(n, zero<I>()), hana::is_empty(xs)),
-                hana::always(xs),
-                hana::lazy(hana::lockstep(drop.at_most)(tail, pred))(xs, n)
-            );
-        }
-    };
+    struct drop_at_most_impl<It, when<condition>>
+        : iterable_detail::drop_at_most_helper<It>, default_
+    { };
 
     //////////////////////////////////////////////////////////////////////////
     // drop.exactly
@@ -183,14 +262,37 @@ namespace boost { namespace hana {
     template <typename It, typename>
     struct drop_exactly_impl : drop_exactly_impl<It, when<true>> { };
 
+    namespace iterable_detail {
+        template <typename It, bool = random_access_sequence<It>{}()>
+        struct drop_exactly_helper {
+            template <typename Xs, typename N>
+            static constexpr auto apply(Xs&& xs, N const&) {
+                constexpr auto n = hana::value<N>();
+                return hana::iterate<n>(hana::tail)(static_cast<Xs&&>(xs));
+            }
+        };
+
+        template <typename It>
+        struct drop_exactly_helper<It, true> {
+            template <typename Xs, typename N>
+            static constexpr auto apply(Xs&& xs, N const&) {
+                constexpr detail::std::size_t n = hana::value<N>();
+                constexpr detail::std::size_t len =
+                    hana::value<decltype(hana::length(xs))>();
+                static_assert(n <= len,
+                "hana::drop.exactly(xs, n) requires n to be at most the length of xs");
+                return make_from_indices<It, n>::apply(
+                    static_cast<Xs&&>(xs),
+                    detail::std::make_index_sequence<len - n>{}
+                );
+            }
+        };
+    }
+
     template <typename It, bool condition>
-    struct drop_exactly_impl<It, when<condition>> : default_ {
-        template <typename Xs, typename N>
-        static constexpr auto apply(Xs&& xs, N const&) {
-            constexpr auto n = hana::value<N>();
-            return hana::iterate<n>(hana::tail)(static_cast<Xs&&>(xs));
-        }
-    };
+    struct drop_exactly_impl<It, when<condition>>
+        : iterable_detail::drop_exactly_helper<It>, default_
+    { };
 
     //////////////////////////////////////////////////////////////////////////
     // drop_c
@@ -356,14 +458,69 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     // Model of Searchable
     //////////////////////////////////////////////////////////////////////////
+    namespace iterable_detail {
+        template <typename It, bool = random_access<It>{}()>
+        struct find_if_helper {
+            template <typename Xs, typename Pred>
+            static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+                return hana::only_when(hana::compose(not_, is_empty), head,
+                    hana::drop_until(static_cast<Xs&&>(xs),
+                                     static_cast<Pred&&>(pred))
+                );
+            }
+        };
+
+        // Looks for the first index in [i, n) whose element satisfies the
+        // predicate. The predicate is not applied to the elements following
+        // the one that is found, which is required by `Searchable`.
+        template <detail::std::size_t i, detail::std::size_t n>
+        struct find_if_at {
+            template <typename Xs, typename Pred>
+            static constexpr auto apply(Xs&& xs, Pred&& pred) {
+                constexpr bool found = hana::value<decltype(
+                    pred(hana::at(xs, size_t<i>))
+                )>();
+                return find_if_at::apply(static_cast<Xs&&>(xs),
+                                         static_cast<Pred&&>(pred),
+                                         bool_<found>);
+            }
+
+            template <typename Xs, typename Pred>
+            static constexpr auto apply(Xs&& xs, Pred&&, decltype(true_))
+            { return hana::just(hana::at(static_cast<Xs&&>(xs), size_t<i>)); }
+
+            template <typename Xs, typename Pred>
+            static constexpr auto apply(Xs&& xs, Pred&& pred, decltype(false_)) {
+                return find_if_at<i + 1, n>::apply(static_cast<Xs&&>(xs),
+                                                   static_cast<Pred&&>(pred));
+            }
+        };
+
+        template <detail::std::size_t n>
+        struct find_if_at<n, n> {
+            template <typename Xs, typename Pred>
+            static constexpr auto apply(Xs&&, Pred&&)
+            { return hana::nothing; }
+        };
+
+        template <typename It>
+        struct find_if_helper<It, true> {
+            template <typename Xs, typename Pred>
+            static constexpr auto apply(Xs&& xs, Pred&& pred) {
+                constexpr detail::std::size_t n =
+                    hana::value<decltype(hana::length(xs))>();
+                return find_if_at<0, n>::apply(static_cast<Xs&&>(xs),
+                                               static_cast<Pred&&>(pred));
+            }
+        };
+    }
+
     template <typename It>
     struct Iterable::find_if_impl {
         template <typename Xs, typename Pred>
         static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
-            return hana::only_when(hana::compose(not_, is_empty), head,
-                hana::drop_until(static_cast<Xs&&>(xs),
-                                 static_cast<Pred&&>(pred))
-            );
+            return iterable_detail::find_if_helper<It>::apply(
+                static_cast<Xs&&>(xs), static_cast<Pred&&>(pred));
         }
     };
 
@@ -70,10 +70,16 @@ namespace boost { namespace hana {
     template <typename F, typename Args>
     struct _lazy_apply;
 
+    // The arguments are stored in the inherited closure, and the function
+    // is stored right after them, in an element of its own. This way, empty
+    // functions and arguments take no space in the `_lazy_apply` object.
     template <typename F, typename ...Args>
-    struct _lazy_apply<F, detail::closure_impl<Args...>> : operators::adl {
-        F function;
-        detail::closure_impl<Args...> args;
+    struct _lazy_apply<F, detail::closure_impl<Args...>>
+        : operators::adl_for<_lazy_apply<F, detail::closure_impl<Args...>>>
+        , detail::closure_impl<Args...>
+        , detail::element<sizeof...(Args), F>
+    {
+        using Function = detail::element<sizeof...(Args), F>;
 
         _lazy_apply(_lazy_apply const&) = default;
         _lazy_apply(_lazy_apply&&) = default;
@@ -85,8 +91,8 @@ namespace boost { namespace hana {
                                     detail::std::declval<Args_>()...))
         >
         explicit constexpr _lazy_apply(F_&& f, Args_&& ...x)
-            : function(static_cast<F_&&>(f))
-            , args(static_cast<Args_&&>(x)...)
+            : detail::closure_impl<Args...>(static_cast<Args_&&>(x)...)
+            , Function{static_cast<F_&&>(f)}
         { }
 
         using hana = _lazy_apply;
@@ -94,7 +100,7 @@ namespace boost { namespace hana {
     };
 
     template <typename X>
-    struct _lazy_value : operators::adl {
+    struct _lazy_value : operators::adl_for<_lazy_value<X>> {
         X value;
 
         _lazy_value(_lazy_value const&) = default;
@@ -152,19 +158,27 @@ namespace boost { namespace hana {
         // _lazy_apply
         template <typename F, typename ...Args>
         static constexpr decltype(auto)
-        apply(_lazy_apply<F, detail::closure_impl<Args...>> const& expr)
-        { return expr.function(static_cast<Args const&>(expr.args).get...); }
+        apply(_lazy_apply<F, detail::closure_impl<Args...>> const& expr) {
+            return detail::get<sizeof...(Args)>(expr)(
+                detail::get(static_cast<Args const&>(expr))...
+            );
+        }
 
         template <typename F, typename ...Args>
         static constexpr decltype(auto)
-        apply(_lazy_apply<F, detail::closure_impl<Args...>>& expr)
-        { return expr.function(static_cast<Args&>(expr.args).get...); }
+        apply(_lazy_apply<F, detail::closure_impl<Args...>>& expr) {
+            return detail::get<sizeof...(Args)>(expr)(
+                detail::get(static_cast<Args&>(expr))...
+            );
+        }
 
         template <typename F, typename ...Args>
         static constexpr decltype(auto)
         apply(_lazy_apply<F, detail::closure_impl<Args...>>&& expr) {
-            return detail::std::move(expr.function)(
-                                    static_cast<Args&&>(expr.args).get...);
+            using Expr = _lazy_apply<F, detail::closure_impl<Args...>>;
+            return detail::get<sizeof...(Args)>(static_cast<Expr&&>(expr))(
+                detail::get(static_cast<Args&&>(expr))...
+            );
         }
 
         // _lazy_value
@@ -19,18 +19,26 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/operators.hpp>
 #include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/closure.hpp>
 #include <boost/hana/detail/erase_key_fwd.hpp>
 #include <boost/hana/detail/insert_fwd.hpp>
+#include <boost/hana/detail/key_index.hpp>
 #include <boost/hana/detail/keys_fwd.hpp>
 #include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
 #include <boost/hana/detail/std/move.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
 #include <boost/hana/foldable.hpp>
 #include <boost/hana/functional/compose.hpp>
 #include <boost/hana/functional/demux.hpp>
 #include <boost/hana/functional/partial.hpp>
 #include <boost/hana/functor.hpp>
-#include <boost/hana/lazy.hpp>
+#include <boost/hana/fwd/pair.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/logical.hpp>
+#include <boost/hana/optional.hpp>
 #include <boost/hana/product.hpp>
 #include <boost/hana/searchable.hpp>
 #include <boost/hana/tuple.hpp>
@@ -41,7 +49,10 @@ namespace boost { namespace hana {
     // _map
     //////////////////////////////////////////////////////////////////////////
     template <typename ...Pairs>
-    struct _map : operators::adl, operators::Searchable_ops<_map<Pairs...>> {
+    struct _map
+        : operators::adl_for<_map<Pairs...>>
+        , operators::Searchable_ops<_map<Pairs...>>
+    {
         _tuple<Pairs...> storage;
         using hana = _map;
         using datatype = Map;
@@ -50,6 +61,8 @@ namespace boost { namespace hana {
         _map(_map const&) = default;
         _map(_map&&) = default;
         _map(_map&) = default;
+        _map& operator=(_map const&) = default;
+        _map& operator=(_map&&) = default;
         template <typename ...Ys>
         explicit constexpr _map(Ys&& ...ys)
             : storage{static_cast<Ys&&>(ys)...}
@@ -107,45 +120,48 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     // insert
     //////////////////////////////////////////////////////////////////////////
+    namespace map_detail {
+        // Creates a map holding the pairs at the given indices of the
+        // `storage` tuple, followed by `pairs...`. Each pair is copied or
+        // moved only once, and the pairs of `storage` are moved when it is
+        // an rvalue.
+        template <typename Storage, detail::std::size_t ...i, typename ...P>
+        constexpr auto rebuild(Storage&& storage,
+                               detail::std::index_sequence<i...>,
+                               P&& ...pairs)
+        {
+            return hana::make<Map>(
+                detail::get<i>(static_cast<Storage&&>(storage))...,
+                static_cast<P&&>(pairs)...
+            );
+        }
+
+        template <typename M>
+        using size = tuple_detail::size<decltype(
+            detail::std::declval<M>().storage
+        )>;
+    }
+
     template <>
     struct insert_impl<Map> {
-        struct insert_helper {
-            template <typename M, typename P>
-            constexpr decltype(auto) operator()(M&& map, P&& pair) const {
-                return hana::unpack(
-                    hana::append(static_cast<M&&>(map).storage,
-                                 static_cast<P&&>(pair)),
-                    hana::make<Map>
-                );
-            }
-        };
+        template <typename M, typename P>
+        static constexpr typename detail::std::decay<M>::type
+        insert_helper(M&& map, P&&, decltype(true_))
+        { return static_cast<M&&>(map); }
 
         template <typename M, typename P>
-        static constexpr decltype(auto) apply(M&& map, P&& pair) {
-            return hana::eval_if(hana::contains(map, hana::first(pair)),
-                hana::lazy(map),
-                hana::lazy(insert_helper{})(map, pair)
-            );
+        static constexpr auto
+        insert_helper(M&& map, P&& pair, decltype(false_)) {
+            return map_detail::rebuild(static_cast<M&&>(map).storage,
+                detail::std::make_index_sequence<map_detail::size<M>{}()>{},
+                static_cast<P&&>(pair));
         }
-    };
 
-    //////////////////////////////////////////////////////////////////////////
-    // erase_key
-    //////////////////////////////////////////////////////////////////////////
-    template <>
-    struct erase_key_impl<Map> {
-        template <typename M, typename Key>
-        static constexpr decltype(auto) apply(M&& map, Key&& key) {
-            return hana::unpack(
-                hana::remove_if(
-                    static_cast<M&&>(map).storage,
-                    hana::compose(
-                        hana::equal.to(static_cast<Key&&>(key)),
-                        hana::first
-                    )
-                ),
-                make<Map>
-            );
+        template <typename M, typename P>
+        static constexpr decltype(auto) apply(M&& map, P&& pair) {
+            using Contains = decltype(hana::contains(map, hana::first(pair)));
+            return insert_helper(static_cast<M&&>(map), static_cast<P&&>(pair),
+                                 hana::bool_<hana::value<Contains>()>);
         }
     };
 
@@ -169,6 +185,117 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     // Searchable
     //////////////////////////////////////////////////////////////////////////
+    namespace map_detail {
+        template <typename Pair>
+        struct key_of {
+            using type = typename detail::std::decay<decltype(
+                hana::first(detail::std::declval<Pair>())
+            )>::type;
+        };
+
+        template <typename First, typename Second>
+        struct key_of<_pair<First, Second>> { using type = First; };
+
+        template <typename Map, typename Key>
+        struct lookup;
+
+        template <typename ...Pairs, typename Key>
+        struct lookup<_map<Pairs...>, Key> {
+            using type = typename detail::key_index<
+                typename key_of<Pairs>::type...
+            >::template lookup<Key>;
+        };
+
+        // Looks up a key in a map without comparing it with the keys of the
+        // map, when possible. See `detail::key_index` for details.
+        template <typename Map, typename Key>
+        using lookup_t = typename lookup<
+            typename detail::std::decay<Map>::type,
+            typename detail::std::decay<Key>::type
+        >::type;
+    }
+
+    template <>
+    struct find_impl<Map> {
+        template <typename M, typename Key, detail::std::size_t i>
+        static constexpr auto
+        find_helper(M&& map, Key&&,
+                    detail::std::integral_constant<detail::std::size_t, i>)
+        {
+            return hana::just(hana::second(
+                detail::get<i>(static_cast<M&&>(map).storage)
+            ));
+        }
+
+        template <typename M, typename Key>
+        static constexpr auto
+        find_helper(M&&, Key&&, detail::key_missing)
+        { return nothing; }
+
+        template <typename M, typename Key>
+        static constexpr auto
+        find_helper(M&& map, Key&& key, detail::key_unknown) {
+            return hana::find_if(static_cast<M&&>(map),
+                                 hana::equal.to(static_cast<Key&&>(key)));
+        }
+
+        template <typename M, typename Key>
+        static constexpr auto apply(M&& map, Key&& key) {
+            return find_helper(static_cast<M&&>(map), static_cast<Key&&>(key),
+                               map_detail::lookup_t<M, Key>{});
+        }
+    };
+
+    template <>
+    struct at_key_impl<Map> {
+        template <typename M, typename Key, detail::std::size_t i>
+        static constexpr auto
+        at_key_helper(M&& map, Key&&,
+                      detail::std::integral_constant<detail::std::size_t, i>)
+        { return hana::second(detail::get<i>(static_cast<M&&>(map).storage)); }
+
+        template <typename M, typename Key, typename Otherwise>
+        static constexpr auto at_key_helper(M&& map, Key&& key, Otherwise) {
+            return hana::from_just(find_impl<Map>::apply(
+                static_cast<M&&>(map), static_cast<Key&&>(key)
+            ));
+        }
+
+        template <typename M, typename Key>
+        static constexpr auto apply(M&& map, Key&& key) {
+            return at_key_helper(static_cast<M&&>(map), static_cast<Key&&>(key),
+                                 map_detail::lookup_t<M, Key>{});
+        }
+    };
+
+    template <>
+    struct contains_impl<Map> {
+        template <typename M, typename Key, detail::std::size_t i>
+        static constexpr auto
+        contains_helper(M const&, Key const&,
+                        detail::std::integral_constant<detail::std::size_t, i>)
+        { return true_; }
+
+        template <typename M, typename Key>
+        static constexpr auto
+        contains_helper(M const&, Key const&, detail::key_missing)
+        { return false_; }
+
+        template <typename M, typename Key>
+        static constexpr auto
+        contains_helper(M&& map, Key&& key, detail::key_unknown) {
+            return hana::any_of(static_cast<M&&>(map),
+                                hana::equal.to(static_cast<Key&&>(key)));
+        }
+
+        template <typename M, typename Key>
+        static constexpr auto apply(M&& map, Key&& key) {
+            return contains_helper(static_cast<M&&>(map),
+                                   static_cast<Key&&>(key),
+                                   map_detail::lookup_t<M, Key>{});
+        }
+    };
+
     template <>
     struct find_if_impl<Map> {
         template <typename M, typename Pred>
@@ -184,8 +311,47 @@ namespace boost { namespace hana {
     template <>
     struct any_of_impl<Map> {
         template <typename M, typename Pred>
-        static constexpr auto apply(M map, Pred pred)
-        { return hana::any_of(hana::keys(map), pred); }
+        static constexpr auto apply(M const& map, Pred&& pred)
+        { return hana::any_of(hana::keys(map), static_cast<Pred&&>(pred)); }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // erase_key
+    //////////////////////////////////////////////////////////////////////////
+    // erase_key is defined after the Searchable instance, because it looks
+    // up the key to erase with `map_detail::lookup_t`.
+    template <>
+    struct erase_key_impl<Map> {
+        template <typename M, typename Key, detail::std::size_t i>
+        static constexpr auto
+        erase_helper(M&& map, Key&&,
+                     detail::std::integral_constant<detail::std::size_t, i>)
+        {
+            return map_detail::rebuild(static_cast<M&&>(map).storage,
+                tuple_detail::generate_index_sequence<
+                    tuple_detail::indices_without<map_detail::size<M>{}(), i>
+                >());
+        }
+
+        template <typename M, typename Key>
+        static constexpr typename detail::std::decay<M>::type
+        erase_helper(M&& map, Key&&, detail::key_missing)
+        { return static_cast<M&&>(map); }
+
+        template <typename M, typename Key>
+        static constexpr auto
+        erase_helper(M&& map, Key&& key, detail::key_unknown) {
+            auto indices = filter_impl<Tuple>::filter_indices(map.storage,
+                hana::compose(hana::not_, hana::equal.to(static_cast<Key&&>(key)),
+                              hana::first));
+            return map_detail::rebuild(static_cast<M&&>(map).storage, indices);
+        }
+
+        template <typename M, typename Key>
+        static constexpr decltype(auto) apply(M&& map, Key&& key) {
+            return erase_helper(static_cast<M&&>(map), static_cast<Key&&>(key),
+                                map_detail::lookup_t<M, Key>{});
+        }
     };
 
     //////////////////////////////////////////////////////////////////////////
@@ -200,16 +366,67 @@ namespace boost { namespace hana {
         }
     };
 
+    template <>
+    struct visit_at_with_index_impl<Map> {
+        template <typename M, typename F, typename Fallback>
+        static constexpr decltype(auto)
+        apply(M&& map, detail::std::size_t i, F&& f, Fallback&& fallback) {
+            return hana::visit_at.with_index(static_cast<M&&>(map).storage, i,
+                                             static_cast<F&&>(f),
+                                             static_cast<Fallback&&>(fallback));
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Construction from a Foldable
     //////////////////////////////////////////////////////////////////////////
+    namespace map_detail {
+        template <typename Index>
+        struct unique_positions {
+            static constexpr auto apply()
+            { return Index::unique_positions(); }
+        };
+
+        struct make_unique {
+            // When the keys can be told apart by their type only, the pairs
+            // with a duplicate key are dropped in a single pass. Otherwise,
+            // the pairs are inserted one at a time, which requires comparing
+            // their keys. In both cases, the pairs are only referred to by
+            // `pairs` and they are copied or moved once, into the map.
+            template <typename Index, typename Pairs>
+            static constexpr auto helper(decltype(true_), Pairs&& pairs) {
+                return map_detail::rebuild(static_cast<Pairs&&>(pairs),
+                    tuple_detail::generate_index_sequence<
+                        unique_positions<Index>
+                    >()
+                );
+            }
+
+            template <typename Index, typename Pairs>
+            static constexpr auto helper(decltype(false_), Pairs&& pairs) {
+                return hana::fold.left(static_cast<Pairs&&>(pairs),
+                                       hana::make<Map>(), hana::insert);
+            }
+
+            template <typename ...Pairs>
+            constexpr auto operator()(Pairs&& ...pairs) const {
+                using Index = detail::key_index<
+                    typename key_of<typename detail::std::decay<Pairs>::type>::type...
+                >;
+                return make_unique::helper<Index>(
+                    bool_<Index::distinct_by_type()>,
+                    hana::forward_as_tuple(static_cast<Pairs&&>(pairs)...)
+                );
+            }
+        };
+    }
+
     template <typename F>
     struct to_impl<Map, F, when<_models<Foldable, F>{}()>> {
         template <typename Xs>
         static constexpr decltype(auto) apply(Xs&& xs) {
-            return hana::fold.left(
-                static_cast<Xs&&>(xs), hana::make<Map>(), hana::insert
-            );
+            return hana::unpack(static_cast<Xs&&>(xs),
+                                map_detail::make_unique{});
         }
     };
 }} // end namespace boost::hana
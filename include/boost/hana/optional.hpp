@@ -54,7 +54,7 @@ namespace boost { namespace hana {
     }
 
     template <typename T>
-    struct _just : operators::adl, maybe_detail::nested_type<T> {
+    struct _just : operators::adl_for<_just<T>>, maybe_detail::nested_type<T> {
         T val;
         static constexpr bool is_just = true;
         struct hana { using datatype = Optional; };
@@ -0,0 +1,444 @@
+/*!
+@file
+Defines `boost::hana::PackedTuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_PACKED_TUPLE_HPP
+#define BOOST_HANA_PACKED_TUPLE_HPP
+
+#include <boost/hana/fwd/packed_tuple.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/core/operators.hpp>
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/constexpr/array.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/enable_if.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/variadic/foldl1.hpp>
+#include <boost/hana/detail/variadic/foldr1.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/functional/partial.hpp>
+#include <boost/hana/functor.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/monad.hpp>
+#include <boost/hana/monad_plus.hpp>
+#include <boost/hana/orderable.hpp>
+#include <boost/hana/searchable.hpp>
+#include <boost/hana/sequence.hpp>
+#include <boost/hana/type.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // layout
+    //////////////////////////////////////////////////////////////////////////
+    namespace packed_tuple_detail {
+        template <detail::std::size_t n, typename X>
+        struct indexed { };
+
+        template <typename Indices, typename ...Xs>
+        struct indexer;
+
+        template <detail::std::size_t ...n, typename ...Xs>
+        struct indexer<detail::std::index_sequence<n...>, Xs...>
+            : indexed<n, Xs>...
+        { };
+
+        template <detail::std::size_t n, typename X>
+        indexed<n, X> type_at(indexed<n, X> const&);
+
+        template <typename Indexed>
+        struct unwrap;
+
+        template <detail::std::size_t n, typename X>
+        struct unwrap<indexed<n, X>> { using type = X; };
+
+        template <typename Order, typename ...Xs>
+        struct make_storage;
+
+        // The storage holds the elements in the order given by `Order`,
+        // which is a permutation of their logical indices.
+        template <detail::std::size_t ...k, typename ...Xs>
+        struct make_storage<detail::std::index_sequence<k...>, Xs...> {
+            using Indexer = indexer<
+                detail::std::make_index_sequence<sizeof...(Xs)>, Xs...
+            >;
+
+            using type = detail::closure<typename unwrap<decltype(
+                packed_tuple_detail::type_at<k>(detail::std::declval<Indexer>())
+            )>::type...>;
+        };
+
+        // Computes where each element of a `_packed_tuple<Xs...>` is stored.
+        //
+        // Elements are stored by decreasing alignment, which is sufficient
+        // to eliminate the padding between them since the size of a type
+        // is always a multiple of its alignment. Elements with the same
+        // alignment are kept in their relative order.
+        template <typename ...Xs>
+        struct layout {
+            static constexpr detail::std::size_t size = sizeof...(Xs);
+            using Indices = detail::constexpr_::array<detail::std::size_t, size>;
+
+            static constexpr Indices compute_position() {
+                constexpr detail::std::size_t alignments[] = {0,
+                    decltype(hana::alignof_(hana::type<Xs>))::value...
+                };
+                Indices result{};
+                for (detail::std::size_t i = 0; i < size; ++i) {
+                    for (detail::std::size_t j = 0; j < size; ++j) {
+                        if (alignments[j + 1] > alignments[i + 1] ||
+                            (alignments[j + 1] == alignments[i + 1] && j < i))
+                            ++result[i];
+                    }
+                }
+                return result;
+            }
+
+            static constexpr Indices compute_order() {
+                Indices position = compute_position();
+                Indices result{};
+                for (detail::std::size_t i = 0; i < size; ++i)
+                    result[position[i]] = i;
+                return result;
+            }
+
+            //! `position[i]` is the position in the storage of the i-th
+            //! element, and `order[k]` is the logical index of the element
+            //! at the k-th position in the storage.
+            static constexpr Indices position = compute_position();
+            static constexpr Indices order = compute_order();
+
+            template <typename Positions>
+            struct order_sequence_impl;
+
+            template <detail::std::size_t ...k>
+            struct order_sequence_impl<detail::std::index_sequence<k...>> {
+                using type = detail::std::index_sequence<order[k]...>;
+            };
+
+            using order_sequence = typename order_sequence_impl<
+                detail::std::make_index_sequence<size>
+            >::type;
+
+            using storage = typename make_storage<order_sequence, Xs...>::type;
+        };
+
+        template <typename ...Xs>
+        constexpr typename layout<Xs...>::Indices layout<Xs...>::position;
+
+        template <typename ...Xs>
+        constexpr typename layout<Xs...>::Indices layout<Xs...>::order;
+
+        struct from_refs { };
+
+        template <detail::std::size_t n, typename Y>
+        constexpr Y forward_at(detail::element<n, Y, false> const& ref)
+        { return static_cast<Y>(ref.get); }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // _packed_tuple
+    //////////////////////////////////////////////////////////////////////////
+    template <typename ...Xs>
+    struct _packed_tuple
+        : operators::adl_for<_packed_tuple<Xs...>>
+        , operators::Iterable_ops<_packed_tuple<Xs...>>
+    {
+        using layout = packed_tuple_detail::layout<Xs...>;
+        typename layout::storage storage;
+
+        using hana = _packed_tuple;
+        using datatype = PackedTuple;
+
+        static constexpr detail::std::size_t size = sizeof...(Xs);
+
+        _packed_tuple() = default;
+        _packed_tuple(_packed_tuple&&) = default;
+        _packed_tuple(_packed_tuple const&) = default;
+        _packed_tuple(_packed_tuple&) = default;
+        _packed_tuple& operator=(_packed_tuple const&) = default;
+        _packed_tuple& operator=(_packed_tuple&&) = default;
+
+        // The elements are received in their logical order, and they are
+        // forwarded to the storage in the order of the layout.
+        template <typename ...Ys, typename = typename detail::std::enable_if<
+            sizeof...(Ys) == sizeof...(Xs) && sizeof...(Ys) != 0
+        >::type>
+        explicit constexpr _packed_tuple(Ys&& ...ys)
+            : _packed_tuple{packed_tuple_detail::from_refs{},
+                            detail::closure<Ys&&...>{static_cast<Ys&&>(ys)...},
+                            typename layout::order_sequence{}}
+        { }
+
+    private:
+        template <typename Refs, detail::std::size_t ...k>
+        constexpr _packed_tuple(packed_tuple_detail::from_refs, Refs&& refs,
+                                detail::std::index_sequence<k...>)
+            : storage{packed_tuple_detail::forward_at<k>(refs)...}
+        { }
+    };
+
+    namespace operators {
+        template <>
+        struct of<PackedTuple>
+            : operators::of<Comparable, Orderable, Monad, Iterable>
+        { };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // make
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct make_impl<PackedTuple> {
+        template <typename ...Xs>
+        static constexpr
+        _packed_tuple<typename detail::std::decay<Xs>::type...> apply(Xs&& ...xs) {
+            return _packed_tuple<typename detail::std::decay<Xs>::type...>{
+                static_cast<Xs&&>(xs)...
+            };
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // utilities
+    //////////////////////////////////////////////////////////////////////////
+    namespace packed_tuple_detail {
+        template <typename Xs>
+        using layout_of = typename detail::std::remove_reference<Xs>::type::layout;
+
+        // Returns the element at the logical index `n`.
+        template <detail::std::size_t n, typename Xs>
+        constexpr decltype(auto) get(Xs&& xs) {
+            return detail::get<layout_of<Xs>::position[n]>(
+                static_cast<Xs&&>(xs).storage
+            );
+        }
+
+        template <typename Xs>
+        using indices = detail::std::make_index_sequence<
+            detail::std::remove_reference<Xs>::type::size
+        >;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<PackedTuple> {
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        unpack_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+            return static_cast<F&&>(f)(
+                packed_tuple_detail::get<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            return unpack_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                 packed_tuple_detail::indices<Xs>{});
+        }
+    };
+
+    // Sequences fold with `head` and `tail` by default, but a packed tuple
+    // can be unpacked directly, like a `Tuple`.
+    template <>
+    struct fold_left_impl<PackedTuple> {
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            return hana::unpack(static_cast<Xs&&>(xs),
+                hana::partial(detail::variadic::foldl1,
+                              static_cast<F&&>(f), static_cast<S&&>(s))
+            );
+        }
+    };
+
+    template <>
+    struct fold_right_impl<PackedTuple> {
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            return hana::unpack(static_cast<Xs&&>(xs),
+                hana::partial(detail::variadic::foldr,
+                              static_cast<F&&>(f), static_cast<S&&>(s))
+            );
+        }
+    };
+
+    template <>
+    struct fold_left_nostate_impl<PackedTuple>
+        : foldable_detail::foldl1_helper<PackedTuple>
+    { };
+
+    template <>
+    struct fold_right_nostate_impl<PackedTuple>
+        : foldable_detail::foldr1_helper<PackedTuple>
+    { };
+
+    template <>
+    struct length_impl<PackedTuple> {
+        template <typename ...Xs>
+        static constexpr auto apply(_packed_tuple<Xs...> const&)
+        { return size_t<sizeof...(Xs)>; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Iterable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct at_impl<PackedTuple> {
+        template <typename Xs, typename N>
+        static constexpr decltype(auto) apply(Xs&& xs, N const&) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            return packed_tuple_detail::get<n>(static_cast<Xs&&>(xs));
+        }
+    };
+
+    template <>
+    struct random_access<PackedTuple>
+        : _integral_constant<bool, true>
+    { };
+
+    template <>
+    struct head_impl<PackedTuple> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs)
+        { return packed_tuple_detail::get<0>(static_cast<Xs&&>(xs)); }
+    };
+
+    template <>
+    struct tail_impl<PackedTuple> {
+        template <typename Xs, detail::std::size_t ...i>
+        static constexpr auto
+        tail_helper(Xs&& xs, detail::std::index_sequence<i...>) {
+            return hana::make<PackedTuple>(
+                packed_tuple_detail::get<i + 1>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs>
+        static constexpr auto apply(Xs&& xs) {
+            constexpr detail::std::size_t N =
+                detail::std::remove_reference<Xs>::type::size;
+            return tail_helper(static_cast<Xs&&>(xs),
+                               detail::std::make_index_sequence<N - 1>{});
+        }
+    };
+
+    template <>
+    struct is_empty_impl<PackedTuple> {
+        template <typename ...Xs>
+        static constexpr auto apply(_packed_tuple<Xs...> const&)
+        { return bool_<sizeof...(Xs) == 0>; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct transform_impl<PackedTuple> {
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        static constexpr auto
+        transform_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+            return hana::make<PackedTuple>(
+                f(packed_tuple_detail::get<i>(static_cast<Xs&&>(xs)))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr auto apply(Xs&& xs, F&& f) {
+            return transform_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                    packed_tuple_detail::indices<Xs>{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // MonadPlus
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct concat_impl<PackedTuple> {
+        template <typename Xs, typename Ys,
+                  detail::std::size_t ...i, detail::std::size_t ...j>
+        static constexpr auto
+        concat_helper(Xs&& xs, Ys&& ys, detail::std::index_sequence<i...>,
+                                        detail::std::index_sequence<j...>)
+        {
+            return hana::make<PackedTuple>(
+                packed_tuple_detail::get<i>(static_cast<Xs&&>(xs))...,
+                packed_tuple_detail::get<j>(static_cast<Ys&&>(ys))...
+            );
+        }
+
+        template <typename Xs, typename Ys>
+        static constexpr auto apply(Xs&& xs, Ys&& ys) {
+            return concat_helper(static_cast<Xs&&>(xs), static_cast<Ys&&>(ys),
+                                 packed_tuple_detail::indices<Xs>{},
+                                 packed_tuple_detail::indices<Ys>{});
+        }
+    };
+
+    template <>
+    struct prepend_impl<PackedTuple> {
+        template <typename Xs, typename X, detail::std::size_t ...i>
+        static constexpr auto
+        prepend_helper(Xs&& xs, X&& x, detail::std::index_sequence<i...>) {
+            return hana::make<PackedTuple>(
+                static_cast<X&&>(x),
+                packed_tuple_detail::get<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename X>
+        static constexpr auto apply(Xs&& xs, X&& x) {
+            return prepend_helper(static_cast<Xs&&>(xs), static_cast<X&&>(x),
+                                  packed_tuple_detail::indices<Xs>{});
+        }
+    };
+
+    template <>
+    struct append_impl<PackedTuple> {
+        template <typename Xs, typename X, detail::std::size_t ...i>
+        static constexpr auto
+        append_helper(Xs&& xs, X&& x, detail::std::index_sequence<i...>) {
+            return hana::make<PackedTuple>(
+                packed_tuple_detail::get<i>(static_cast<Xs&&>(xs))...,
+                static_cast<X&&>(x)
+            );
+        }
+
+        template <typename Xs, typename X>
+        static constexpr auto apply(Xs&& xs, X&& x) {
+            return append_helper(static_cast<Xs&&>(xs), static_cast<X&&>(x),
+                                 packed_tuple_detail::indices<Xs>{});
+        }
+    };
+
+    template <>
+    struct empty_impl<PackedTuple> {
+        static constexpr _packed_tuple<> apply()
+        { return {}; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Sequence
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct models_impl<Sequence, PackedTuple>
+        : decltype(true_)
+    { };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_PACKED_TUPLE_HPP
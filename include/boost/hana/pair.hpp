@@ -15,7 +15,9 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/comparable.hpp>
 #include <boost/hana/core/make.hpp>
 #include <boost/hana/core/operators.hpp>
+#include <boost/hana/detail/closure.hpp>
 #include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
 #include <boost/hana/orderable.hpp>
 #include <boost/hana/product.hpp>
 
@@ -25,19 +27,19 @@ namespace boost { namespace hana {
     // _pair
     //////////////////////////////////////////////////////////////////////////
     template <typename First, typename Second>
-    struct _pair : operators::adl {
-        First first;
-        Second second;
+    struct _pair : operators::adl_for<_pair<First, Second>> {
+        // The two components are held in a closure so that empty components,
+        // like the `Type` keys of a `Map`, do not take any space.
+        detail::closure<First, Second> storage;
 
-        constexpr _pair() : first{}, second{} { }
+        constexpr _pair() : storage{} { }
 
         template <typename F, typename S, typename = decltype(
             ((void)First(detail::std::declval<F>())),
             ((void)Second(detail::std::declval<S>()))
         )>
         constexpr _pair(F&& f, S&& s)
-            : first(static_cast<F&&>(f))
-            , second(static_cast<S&&>(s))
+            : storage(static_cast<F&&>(f), static_cast<S&&>(s))
         { }
 
         using hana = _pair;
@@ -70,16 +72,34 @@ namespace boost { namespace hana {
 
     template <>
     struct first_impl<Pair> {
-        template <typename P>
-        static constexpr decltype(auto) apply(P&& p)
-        { return static_cast<P&&>(p).first; }
+        // The components are returned by value, as they were when they
+        // were plain data members of the pair.
+        template <typename F, typename S>
+        static constexpr F apply(_pair<F, S> const& p)
+        { return detail::get<0>(p.storage); }
+
+        template <typename F, typename S>
+        static constexpr F apply(_pair<F, S>& p)
+        { return detail::get<0>(p.storage); }
+
+        template <typename F, typename S>
+        static constexpr F apply(_pair<F, S>&& p)
+        { return detail::get<0>(static_cast<_pair<F, S>&&>(p).storage); }
     };
 
     template <>
     struct second_impl<Pair> {
-        template <typename P>
-        static constexpr decltype(auto) apply(P&& p)
-        { return static_cast<P&&>(p).second; }
+        template <typename F, typename S>
+        static constexpr S apply(_pair<F, S> const& p)
+        { return detail::get<1>(p.storage); }
+
+        template <typename F, typename S>
+        static constexpr S apply(_pair<F, S>& p)
+        { return detail::get<1>(p.storage); }
+
+        template <typename F, typename S>
+        static constexpr S apply(_pair<F, S>&& p)
+        { return detail::get<1>(static_cast<_pair<F, S>&&>(p).storage); }
     };
 }} // end namespace boost::hana
 
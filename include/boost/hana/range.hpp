@@ -35,7 +35,7 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     template <typename T, T From, T To>
     struct _range
-        : operators::adl
+        : operators::adl_for<_range<T, From, To>>
         , operators::Iterable_ops<_range<T, From, To>>
     {
         static_assert(From <= To,
@@ -265,6 +265,11 @@ namespace boost { namespace hana {
         }
     };
 
+    template <>
+    struct random_access<Range>
+        : _integral_constant<bool, true>
+    { };
+
     template <>
     struct last_impl<Range> {
         template <typename T, T from, T to>
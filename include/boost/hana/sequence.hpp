@@ -126,6 +126,36 @@ namespace boost { namespace hana {
         constexpr _for2 for2_{};
     } // end namespace sequence_detail
 
+    //////////////////////////////////////////////////////////////////////////
+    // argsort (with a predicate)
+    //////////////////////////////////////////////////////////////////////////
+    template <typename S, typename>
+    struct argsort_pred_impl : argsort_pred_impl<S, when<true>> { };
+
+    template <typename S, bool condition>
+    struct argsort_pred_impl<S, when<condition>> : default_ {
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&& pred) {
+            return hana::to<S>(hana::argsort(
+                hana::to<Tuple>(static_cast<Xs&&>(xs)),
+                static_cast<Pred&&>(pred)
+            ));
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // argsort (without a predicate)
+    //////////////////////////////////////////////////////////////////////////
+    template <typename S, typename>
+    struct argsort_impl : argsort_impl<S, when<true>> { };
+
+    template <typename S, bool condition>
+    struct argsort_impl<S, when<condition>> : default_ {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs)
+        { return hana::argsort(static_cast<Xs&&>(xs), less); }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // cartesian_product
     //////////////////////////////////////////////////////////////////////////
@@ -575,15 +605,36 @@ namespace boost { namespace hana {
     template <typename S, typename>
     struct slice_impl : slice_impl<S, when<true>> { };
 
+    namespace sequence_detail {
+        template <typename S,
+                  bool = iterable_detail::random_access_sequence<S>{}()>
+        struct slice_helper {
+            template <typename Xs, typename From, typename To>
+            static constexpr decltype(auto)
+            apply(Xs&& xs, From const& from, To const& to) {
+                return hana::take(hana::drop(static_cast<Xs&&>(xs), from),
+                                  hana::minus(to, from));
+            }
+        };
+
+        template <typename S>
+        struct slice_helper<S, true> {
+            template <typename Xs, typename From, typename To>
+            static constexpr auto apply(Xs&& xs, From const&, To const&) {
+                constexpr detail::std::size_t from = hana::value<From>();
+                constexpr detail::std::size_t to = hana::value<To>();
+                return iterable_detail::make_from_indices<S, from>::apply(
+                    static_cast<Xs&&>(xs),
+                    detail::std::make_index_sequence<to - from>{}
+                );
+            }
+        };
+    }
+
     template <typename S, bool condition>
-    struct slice_impl<S, when<condition>> : default_ {
-        template <typename Xs, typename From, typename To>
-        static constexpr decltype(auto)
-        apply(Xs&& xs, From const& from, To const& to) {
-            return hana::take(hana::drop(static_cast<Xs&&>(xs), from),
-                              hana::minus(to, from));
-        }
-    };
+    struct slice_impl<S, when<condition>>
+        : sequence_detail::slice_helper<S>, default_
+    { };
 
     //////////////////////////////////////////////////////////////////////////
     // slice_c
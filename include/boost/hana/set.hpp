@@ -19,13 +19,21 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/operators.hpp>
 #include <boost/hana/core/when.hpp>
 #include <boost/hana/detail/erase_key_fwd.hpp>
+#include <boost/hana/detail/closure.hpp>
 #include <boost/hana/detail/insert_fwd.hpp>
+#include <boost/hana/detail/key_index.hpp>
 #include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
 #include <boost/hana/foldable.hpp>
+#include <boost/hana/functional/compose.hpp>
 #include <boost/hana/functional/flip.hpp>
 #include <boost/hana/functional/id.hpp>
-#include <boost/hana/lazy.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/logical.hpp>
+#include <boost/hana/optional.hpp>
 #include <boost/hana/searchable.hpp>
 #include <boost/hana/tuple.hpp>
 
@@ -35,7 +43,10 @@ namespace boost { namespace hana {
     // _set
     //////////////////////////////////////////////////////////////////////////
     template <typename ...Xs>
-    struct _set : operators::adl, operators::Searchable_ops<_set<Xs...>> {
+    struct _set
+        : operators::adl_for<_set<Xs...>>
+        , operators::Searchable_ops<_set<Xs...>>
+    {
         _tuple<Xs...> storage;
         using hana = _set;
         using datatype = Set;
@@ -44,6 +55,8 @@ namespace boost { namespace hana {
         _set(_set const&) = default;
         _set(_set&&) = default;
         _set(_set&) = default;
+        _set& operator=(_set const&) = default;
+        _set& operator=(_set&&) = default;
         template <typename ...Ys>
         explicit constexpr _set(Ys&& ...ys)
             : storage{static_cast<Ys&&>(ys)...}
@@ -99,6 +112,93 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     // Searchable
     //////////////////////////////////////////////////////////////////////////
+    namespace set_detail {
+        template <typename Set, typename Key>
+        struct lookup;
+
+        template <typename ...Xs, typename Key>
+        struct lookup<_set<Xs...>, Key> {
+            using type = typename detail::key_index<Xs...>::
+                         template lookup<Key>;
+        };
+
+        // Looks up an element in a set without comparing it with the
+        // elements of the set, when possible. See `detail::key_index`.
+        template <typename Set, typename Key>
+        using lookup_t = typename lookup<
+            typename detail::std::decay<Set>::type,
+            typename detail::std::decay<Key>::type
+        >::type;
+
+        // Equivalent to `equal.to(x)`, but refers to `x` instead of holding
+        // a copy of it, so that looking up an element never copies it.
+        template <typename X>
+        struct equal_to {
+            X const& x;
+
+            template <typename Y>
+            constexpr decltype(auto) operator()(Y const& y) const
+            { return hana::equal(x, y); }
+        };
+
+        template <typename X>
+        constexpr equal_to<X> equal_to_ref(X const& x)
+        { return {x}; }
+    }
+
+    template <>
+    struct find_impl<Set> {
+        template <typename S, typename X, detail::std::size_t i>
+        static constexpr auto
+        find_helper(S&& set, X&&,
+                    detail::std::integral_constant<detail::std::size_t, i>)
+        { return hana::just(detail::get<i>(static_cast<S&&>(set).storage)); }
+
+        template <typename S, typename X>
+        static constexpr auto find_helper(S&&, X&&, detail::key_missing)
+        { return nothing; }
+
+        template <typename S, typename X>
+        static constexpr auto
+        find_helper(S&& set, X&& x, detail::key_unknown) {
+            return hana::find_if(static_cast<S&&>(set),
+                                 set_detail::equal_to_ref(x));
+        }
+
+        template <typename S, typename X>
+        static constexpr auto apply(S&& set, X&& x) {
+            return find_helper(static_cast<S&&>(set), static_cast<X&&>(x),
+                               set_detail::lookup_t<S, X>{});
+        }
+    };
+
+    template <>
+    struct contains_impl<Set> {
+        template <typename S, typename X, detail::std::size_t i>
+        static constexpr auto
+        contains_helper(S const&, X const&,
+                        detail::std::integral_constant<detail::std::size_t, i>)
+        { return true_; }
+
+        template <typename S, typename X>
+        static constexpr auto
+        contains_helper(S const&, X const&, detail::key_missing)
+        { return false_; }
+
+        template <typename S, typename X>
+        static constexpr auto
+        contains_helper(S&& set, X&& x, detail::key_unknown) {
+            return hana::any_of(static_cast<S&&>(set),
+                                set_detail::equal_to_ref(x));
+        }
+
+        template <typename S, typename X>
+        static constexpr auto apply(S&& set, X&& x) {
+            return contains_helper(static_cast<S&&>(set), static_cast<X&&>(x),
+                                   set_detail::lookup_t<S, X>{});
+        }
+    };
+
     template <>
     struct find_if_impl<Set> {
         template <typename Set, typename Pred>
@@ -120,13 +220,73 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     // Conversions
     //////////////////////////////////////////////////////////////////////////
+    namespace set_detail {
+        // Creates a set holding the elements at the given indices of the
+        // `storage` tuple, followed by `xs...`. Each element is copied or
+        // moved only once, and the elements of `storage` are moved when it
+        // is an rvalue.
+        template <typename Storage, detail::std::size_t ...i, typename ...X>
+        constexpr auto rebuild(Storage&& storage,
+                               detail::std::index_sequence<i...>,
+                               X&& ...xs)
+        {
+            return hana::make<Set>(
+                detail::get<i>(static_cast<Storage&&>(storage))...,
+                static_cast<X&&>(xs)...
+            );
+        }
+
+        template <typename S>
+        using size = tuple_detail::size<decltype(
+            detail::std::declval<S>().storage
+        )>;
+
+        template <typename Index>
+        struct unique_positions {
+            static constexpr auto apply()
+            { return Index::unique_positions(); }
+        };
+
+        struct make_unique {
+            // When the elements can be told apart by their type only, the
+            // duplicates are removed in a single pass. Otherwise, they are
+            // inserted one at a time, which requires comparing them. In both
+            // cases, the elements are only referred to by `xs` and they are
+            // copied or moved once, into the set.
+            template <typename Index, typename Xs>
+            static constexpr auto helper(decltype(true_), Xs&& xs) {
+                return set_detail::rebuild(static_cast<Xs&&>(xs),
+                    tuple_detail::generate_index_sequence<
+                        unique_positions<Index>
+                    >()
+                );
+            }
+
+            template <typename Index, typename Xs>
+            static constexpr auto helper(decltype(false_), Xs&& xs) {
+                return hana::fold.left(static_cast<Xs&&>(xs),
+                                       hana::make<Set>(), hana::insert);
+            }
+
+            template <typename ...Xs>
+            constexpr auto operator()(Xs&& ...xs) const {
+                using Index = detail::key_index<
+                    typename detail::std::decay<Xs>::type...
+                >;
+                return make_unique::helper<Index>(
+                    bool_<Index::distinct_by_type()>,
+                    hana::forward_as_tuple(static_cast<Xs&&>(xs)...)
+                );
+            }
+        };
+    }
+
     template <typename F>
     struct to_impl<Set, F, when<_models<Foldable, F>{}()>> {
         template <typename Xs>
         static constexpr decltype(auto) apply(Xs&& xs) {
-            return hana::fold.left(static_cast<Xs&&>(xs),
-                                   hana::make<Set>(),
-                                   hana::insert);
+            return hana::unpack(static_cast<Xs&&>(xs),
+                                set_detail::make_unique{});
         }
     };
 
@@ -135,23 +295,24 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct insert_impl<Set> {
-        struct insert_helper {
-            template <typename S, typename X>
-            constexpr decltype(auto) operator()(S&& s, X&& x) const {
-                return hana::unpack(
-                    hana::append(static_cast<S&&>(s).storage,
-                                 static_cast<X&&>(x)),
-                    hana::make<Set>
-                );
-            }
-        };
+        template <typename S, typename X>
+        static constexpr typename detail::std::decay<S>::type
+        insert_helper(S&& set, X&&, decltype(true_))
+        { return static_cast<S&&>(set); }
+
+        template <typename S, typename X>
+        static constexpr auto
+        insert_helper(S&& set, X&& x, decltype(false_)) {
+            return set_detail::rebuild(static_cast<S&&>(set).storage,
+                detail::std::make_index_sequence<set_detail::size<S>{}()>{},
+                static_cast<X&&>(x));
+        }
 
         template <typename S, typename X>
         static constexpr decltype(auto) apply(S&& set, X&& x) {
-            return hana::eval_if(hana::contains(set, x),
-                hana::lazy(set),
-                hana::lazy(insert_helper{})(set, x)
-            );
+            using Contains = decltype(hana::contains(set, x));
+            return insert_helper(static_cast<S&&>(set), static_cast<X&&>(x),
+                                 hana::bool_<hana::value<Contains>()>);
         }
     };
 
@@ -160,13 +321,34 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct erase_key_impl<Set> {
+        template <typename S, typename X, detail::std::size_t i>
+        static constexpr auto
+        erase_helper(S&& set, X&&,
+                     detail::std::integral_constant<detail::std::size_t, i>)
+        {
+            return set_detail::rebuild(static_cast<S&&>(set).storage,
+                tuple_detail::generate_index_sequence<
+                    tuple_detail::indices_without<set_detail::size<S>{}(), i>
+                >());
+        }
+
+        template <typename S, typename X>
+        static constexpr typename detail::std::decay<S>::type
+        erase_helper(S&& set, X&&, detail::key_missing)
+        { return static_cast<S&&>(set); }
+
+        template <typename S, typename X>
+        static constexpr auto
+        erase_helper(S&& set, X&& x, detail::key_unknown) {
+            auto indices = filter_impl<Tuple>::filter_indices(set.storage,
+                hana::compose(hana::not_, set_detail::equal_to_ref(x)));
+            return set_detail::rebuild(static_cast<S&&>(set).storage, indices);
+        }
+
         template <typename S, typename X>
         static constexpr decltype(auto) apply(S&& set, X&& x) {
-            return hana::unpack(
-                hana::remove(static_cast<S&&>(set).storage,
-                             static_cast<X&&>(x)),
-                make<Set>
-            );
+            return erase_helper(static_cast<S&&>(set), static_cast<X&&>(x),
+                                set_detail::lookup_t<S, X>{});
         }
     };
 }} // end namespace boost::hana
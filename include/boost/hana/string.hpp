@@ -20,18 +20,26 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/operators.hpp>
 #include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/closure.hpp>
 #include <boost/hana/detail/constexpr/algorithm.hpp>
+#include <boost/hana/detail/constexpr/array.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
 #include <boost/hana/detail/std/enable_if.hpp>
 #include <boost/hana/detail/std/integer_sequence.hpp>
 #include <boost/hana/detail/std/is_same.hpp>
 #include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/wrong.hpp>
 #include <boost/hana/foldable.hpp>
+#include <boost/hana/fwd/pair.hpp>
+#include <boost/hana/fwd/product.hpp>
 #include <boost/hana/integral_constant.hpp>
 #include <boost/hana/iterable.hpp>
 #include <boost/hana/logical.hpp>
 #include <boost/hana/optional.hpp>
 #include <boost/hana/orderable.hpp>
 #include <boost/hana/searchable.hpp>
+#include <boost/hana/tuple.hpp>
 
 
 namespace boost { namespace hana {
@@ -40,7 +48,7 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     template <char ...s>
     struct _string
-        : operators::adl
+        : operators::adl_for<_string<s...>>
         , operators::Iterable_ops<_string<s...>>
     { };
 
@@ -200,6 +208,11 @@ namespace boost { namespace hana {
         }
     };
 
+    template <>
+    struct random_access<String>
+        : _integral_constant<bool, true>
+    { };
+
     //////////////////////////////////////////////////////////////////////////
     // Searchable
     //////////////////////////////////////////////////////////////////////////
@@ -245,6 +258,529 @@ namespace boost { namespace hana {
     struct any_of_impl<String>
         : Iterable::any_of_impl<String>
     { };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Substring algorithms
+    //////////////////////////////////////////////////////////////////////////
+    namespace string_detail {
+        // Gives access to the characters of a `String` as a static array, so
+        // they can be read by constexpr functions and in template arguments.
+        template <typename S>
+        struct chars_of;
+
+        template <char ...s>
+        struct chars_of<_string<s...>> {
+            static constexpr char const* value =
+                                    to_impl<char const*, String>::c_string<s...>;
+            static constexpr detail::std::size_t size = sizeof...(s);
+        };
+
+        template <char ...s>
+        constexpr char const* chars_of<_string<s...>>::value;
+
+        template <char ...s>
+        constexpr detail::std::size_t chars_of<_string<s...>>::size;
+
+        constexpr detail::std::size_t npos = static_cast<detail::std::size_t>(-1);
+
+        // Returns the position of the first occurrence of `sub` in `s` at or
+        // after position `from`, or `npos` if there is none.
+        constexpr detail::std::size_t
+        search(char const* s, detail::std::size_t n,
+               char const* sub, detail::std::size_t m,
+               detail::std::size_t from)
+        {
+            for (detail::std::size_t i = from; i + m <= n; ++i) {
+                detail::std::size_t j = 0;
+                while (j < m && s[i + j] == sub[j])
+                    ++j;
+                if (j == m)
+                    return i;
+            }
+            return npos;
+        }
+
+        // Returns the number of non-overlapping occurrences of `sub` in `s`,
+        // searched from left to right.
+        constexpr detail::std::size_t
+        count(char const* s, detail::std::size_t n,
+              char const* sub, detail::std::size_t m)
+        {
+            detail::std::size_t result = 0;
+            for (detail::std::size_t i = search(s, n, sub, m, 0); i != npos;
+                 i = search(s, n, sub, m, i + m))
+                ++result;
+            return result;
+        }
+
+        // Returns the `String` made of the characters `Chars::value[from + i]...`.
+        template <typename Chars, detail::std::size_t from, detail::std::size_t ...i>
+        constexpr _string<Chars::value[from + i]...>
+        substring(detail::std::index_sequence<i...>)
+        { return {}; }
+
+        template <typename Chars>
+        constexpr auto make_string() {
+            return string_detail::substring<Chars, 0>(
+                detail::std::make_index_sequence<Chars::size>{});
+        }
+
+        // The bounds of the pieces of `S` delimited by `Sep`.
+        template <typename S, typename Sep>
+        struct split_bounds {
+            static constexpr detail::std::size_t pieces =
+                count(S::value, S::size, Sep::value, Sep::size) + 1;
+
+            using bounds_t = detail::constexpr_::array<detail::std::size_t, pieces>;
+
+            static constexpr bounds_t compute_starts() {
+                bounds_t result{};
+                for (detail::std::size_t k = 1; k < pieces; ++k)
+                    result[k] = search(S::value, S::size, Sep::value, Sep::size,
+                                       result[k - 1]) + Sep::size;
+                return result;
+            }
+
+            static constexpr bounds_t starts = compute_starts();
+
+            static constexpr bounds_t compute_lengths() {
+                bounds_t result{};
+                for (detail::std::size_t k = 0; k + 1 < pieces; ++k)
+                    result[k] = starts[k + 1] - Sep::size - starts[k];
+                result[pieces - 1] = S::size - starts[pieces - 1];
+                return result;
+            }
+
+            static constexpr bounds_t lengths = compute_lengths();
+        };
+
+        template <typename S, typename Sep>
+        constexpr typename split_bounds<S, Sep>::bounds_t split_bounds<S, Sep>::starts;
+
+        template <typename S, typename Sep>
+        constexpr typename split_bounds<S, Sep>::bounds_t split_bounds<S, Sep>::lengths;
+
+        template <typename S, typename Bounds, detail::std::size_t ...k>
+        constexpr auto split_impl(detail::std::index_sequence<k...>) {
+            return hana::make<Tuple>(
+                string_detail::substring<S, Bounds::starts[k]>(
+                    detail::std::make_index_sequence<Bounds::lengths[k]>{}
+                )...
+            );
+        }
+
+        // The characters of `S` where every occurrence of `From` is
+        // replaced by `To`.
+        template <typename S, typename From, typename To>
+        struct replaced_chars {
+            static constexpr detail::std::size_t size = S::size +
+                count(S::value, S::size, From::value, From::size) * To::size -
+                count(S::value, S::size, From::value, From::size) * From::size;
+
+            using chars_t = detail::constexpr_::array<char, size>;
+
+            static constexpr chars_t compute() {
+                chars_t result{};
+                detail::std::size_t out = 0;
+                for (detail::std::size_t i = 0; i < S::size; ) {
+                    detail::std::size_t match = search(S::value, S::size,
+                                                       From::value, From::size, i);
+                    detail::std::size_t stop = match == npos ? S::size : match;
+                    while (i < stop)
+                        result[out++] = S::value[i++];
+                    if (match != npos) {
+                        for (detail::std::size_t j = 0; j < To::size; ++j)
+                            result[out++] = To::value[j];
+                        i += From::size;
+                    }
+                }
+                return result;
+            }
+
+            static constexpr chars_t value = compute();
+        };
+
+        template <typename S, typename From, typename To>
+        constexpr typename replaced_chars<S, From, To>::chars_t
+        replaced_chars<S, From, To>::value;
+
+        // The characters of the `Strings` separated by `Sep`.
+        template <typename Sep, typename ...Strings>
+        struct joined_chars {
+            static constexpr detail::std::size_t count = sizeof...(Strings);
+
+            static constexpr detail::std::size_t compute_size() {
+                detail::std::size_t sizes[] = {Strings::size..., 0};
+                detail::std::size_t result = count == 0 ? 0 : (count - 1) * Sep::size;
+                for (detail::std::size_t k = 0; k < count; ++k)
+                    result += sizes[k];
+                return result;
+            }
+
+            static constexpr detail::std::size_t size = compute_size();
+
+            using chars_t = detail::constexpr_::array<char, size>;
+
+            static constexpr chars_t compute() {
+                char const* strings[] = {Strings::value..., nullptr};
+                detail::std::size_t sizes[] = {Strings::size..., 0};
+                chars_t result{};
+                detail::std::size_t out = 0;
+                for (detail::std::size_t k = 0; k < count; ++k) {
+                    if (k != 0)
+                        for (detail::std::size_t j = 0; j < Sep::size; ++j)
+                            result[out++] = Sep::value[j];
+                    for (detail::std::size_t j = 0; j < sizes[k]; ++j)
+                        result[out++] = strings[k][j];
+                }
+                return result;
+            }
+
+            static constexpr chars_t value = compute();
+        };
+
+        template <typename Sep, typename ...Strings>
+        constexpr typename joined_chars<Sep, Strings...>::chars_t
+        joined_chars<Sep, Strings...>::value;
+
+        template <typename Sep>
+        struct joiner {
+            template <typename ...Strings>
+            constexpr auto operator()(Strings const& ...) const {
+                return string_detail::make_string<
+                    joined_chars<Sep, chars_of<Strings>...>
+                >();
+            }
+        };
+    }
+
+    //! @cond
+    template <char ...s, char ...sub>
+    constexpr auto _find_substring::operator()(_string<s...> const&,
+                                               _string<sub...> const&) const
+    {
+        constexpr detail::std::size_t position = string_detail::search(
+            string_detail::chars_of<_string<s...>>::value, sizeof...(s),
+            string_detail::chars_of<_string<sub...>>::value, sizeof...(sub), 0
+        );
+        return hana::if_(bool_<position != string_detail::npos>,
+            hana::just(size_t<position>),
+            nothing
+        );
+    }
+
+    template <char ...s, char ...prefix>
+    constexpr auto _starts_with::operator()(_string<s...> const&,
+                                            _string<prefix...> const&) const
+    {
+        constexpr char const* str = string_detail::chars_of<_string<s...>>::value;
+        constexpr char const* pre = string_detail::chars_of<_string<prefix...>>::value;
+        return bool_<sizeof...(prefix) <= sizeof...(s) &&
+            detail::constexpr_::equal(pre, pre + sizeof...(prefix),
+                                      str, str + sizeof...(prefix))
+        >;
+    }
+
+    template <char ...s, char ...suffix>
+    constexpr auto _ends_with::operator()(_string<s...> const&,
+                                          _string<suffix...> const&) const
+    {
+        constexpr char const* str = string_detail::chars_of<_string<s...>>::value;
+        constexpr char const* suf = string_detail::chars_of<_string<suffix...>>::value;
+        return bool_<sizeof...(suffix) <= sizeof...(s) &&
+            detail::constexpr_::equal(suf, suf + sizeof...(suffix),
+                str + (sizeof...(s) - sizeof...(suffix)), str + sizeof...(s))
+        >;
+    }
+
+    template <char ...s, char ...sep>
+    constexpr auto _split::operator()(_string<s...> const&,
+                                      _string<sep...> const&) const
+    {
+        static_assert(sizeof...(sep) > 0,
+        "hana::split(string, separator) requires the separator to be non-empty");
+
+        using S = string_detail::chars_of<_string<s...>>;
+        using Bounds = string_detail::split_bounds<
+            S, string_detail::chars_of<_string<sep...>>
+        >;
+        return string_detail::split_impl<S, Bounds>(
+            detail::std::make_index_sequence<Bounds::pieces>{});
+    }
+
+    template <char ...s, char ...from, char ...to>
+    constexpr auto _replace_substring::operator()(_string<s...> const&,
+                                                  _string<from...> const&,
+                                                  _string<to...> const&) const
+    {
+        static_assert(sizeof...(from) > 0,
+        "hana::replace_substring(string, from, to) requires 'from' to be non-empty");
+
+        return string_detail::make_string<string_detail::replaced_chars<
+            string_detail::chars_of<_string<s...>>,
+            string_detail::chars_of<_string<from...>>,
+            string_detail::chars_of<_string<to...>>
+        >>();
+    }
+
+    template <typename ...Strings>
+    constexpr auto _string_concat::operator()(Strings const& ...strings) const {
+        return string_detail::joiner<string_detail::chars_of<_string<>>>{}(
+            strings...
+        );
+    }
+
+    template <typename Strings, char ...sep>
+    constexpr auto _string_join::operator()(Strings const& strings,
+                                     _string<sep...> const&) const
+    {
+        return hana::unpack(strings,
+            string_detail::joiner<string_detail::chars_of<_string<sep...>>>{});
+    }
+    //! @endcond
+
+    //////////////////////////////////////////////////////////////////////////
+    // string_switch
+    //////////////////////////////////////////////////////////////////////////
+    namespace string_detail {
+        // 64 bits FNV-1a hash of a runtime or constexpr string.
+        constexpr unsigned long long hash(char const* s, detail::std::size_t n) {
+            unsigned long long h = 14695981039346656037ull;
+            for (detail::std::size_t i = 0; i < n; ++i) {
+                h ^= static_cast<unsigned char>(s[i]);
+                h *= 1099511628211ull;
+            }
+            return h;
+        }
+
+        // Compares the first `n` characters of two strings; neither pointer
+        // is read when `n` is 0, so they may be null in that case.
+        constexpr bool equal_chars(char const* s1, char const* s2,
+                                   detail::std::size_t n)
+        {
+            for (detail::std::size_t i = 0; i < n; ++i)
+                if (s1[i] != s2[i])
+                    return false;
+            return true;
+        }
+
+        // Mixes the hash of a string with a seed, using the finalizer of
+        // MurmurHash3. Changing the seed gives an unrelated hash function.
+        constexpr unsigned long long
+        scramble(unsigned long long h, unsigned long long seed) {
+            h ^= seed * 0x9e3779b97f4a7c15ull;
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdull;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ull;
+            h ^= h >> 33;
+            return h;
+        }
+
+        constexpr detail::std::size_t ceil_pow2(detail::std::size_t n) {
+            detail::std::size_t result = 1;
+            while (result < n)
+                result *= 2;
+            return result;
+        }
+
+        // Perfect hash function over `N` keys, built with the "hash and
+        // displace" method. The keys are spread into buckets of about four
+        // keys using their hash, and each bucket is given a seed such that
+        // `scramble` sends its keys to slots of the table which are not used
+        // by any other key. The table has at least twice as many slots as
+        // there are keys, which makes such seeds easy to find.
+        template <detail::std::size_t N>
+        struct perfect_hash {
+            static constexpr detail::std::size_t buckets = N / 4 + 1;
+            static constexpr detail::std::size_t size = ceil_pow2(2 * N);
+
+            bool found;
+            detail::constexpr_::array<unsigned long long, buckets> seeds;
+
+            // The index of the key stored in each slot, or `N` if the slot
+            // is empty.
+            detail::constexpr_::array<detail::std::size_t, size> slots;
+
+            constexpr detail::std::size_t slot(unsigned long long h) const {
+                return string_detail::scramble(h, seeds[h % buckets])
+                        & (size - 1);
+            }
+        };
+
+        template <detail::std::size_t N>
+        constexpr perfect_hash<N>
+        make_perfect_hash(detail::constexpr_::array<unsigned long long, N> hashes) {
+            using detail::std::size_t;
+            constexpr size_t B = perfect_hash<N>::buckets;
+            constexpr size_t M = perfect_hash<N>::size;
+            constexpr unsigned long long max_seed = 1ull << 16;
+
+            perfect_hash<N> result{false, {}, {}};
+            for (size_t i = 0; i < M; ++i)
+                result.slots[i] = N;
+
+            // Group the keys by bucket; the keys of bucket `b` are
+            // `members[start[b]]` up to `members[start[b + 1]]`.
+            detail::constexpr_::array<size_t, B + 1> start{};
+            for (size_t k = 0; k < N; ++k)
+                ++start[hashes[k] % B + 1];
+            for (size_t b = 0; b < B; ++b)
+                start[b + 1] += start[b];
+
+            detail::constexpr_::array<size_t, N> members{};
+            detail::constexpr_::array<size_t, B> filled{};
+            size_t largest = 0;
+            for (size_t k = 0; k < N; ++k) {
+                size_t b = hashes[k] % B;
+                members[start[b] + filled[b]++] = k;
+                largest = filled[b] > largest ? filled[b] : largest;
+            }
+
+            // Place the largest buckets first, while the table is emptier.
+            detail::constexpr_::array<size_t, N> candidates{};
+            for (size_t count = largest; count > 0; --count) {
+                for (size_t b = 0; b < B; ++b) {
+                    if (start[b + 1] - start[b] != count)
+                        continue;
+
+                    unsigned long long seed = 0;
+                    for (bool fits = false; !fits; ) {
+                        if (seed == max_seed)
+                            return result;
+
+                        fits = true;
+                        for (size_t j = 0; fits && j < count; ++j) {
+                            unsigned long long h = hashes[members[start[b] + j]];
+                            candidates[j] = string_detail::scramble(h, seed)
+                                            & (M - 1);
+                            fits = result.slots[candidates[j]] == N;
+                            for (size_t i = 0; fits && i < j; ++i)
+                                fits = candidates[i] != candidates[j];
+                        }
+                        seed += !fits;
+                    }
+
+                    result.seeds[b] = seed;
+                    for (size_t j = 0; j < count; ++j)
+                        result.slots[candidates[j]] = members[start[b] + j];
+                }
+            }
+
+            result.found = true;
+            return result;
+        }
+
+        template <typename Key>
+        struct key_info {
+            static_assert(detail::wrong<Key>{},
+            "hana::string_switch(map) requires the keys of 'map' to be Strings");
+        };
+
+        template <char ...c>
+        struct key_info<_string<c...>>
+            : chars_of<_string<c...>>
+        { };
+
+        template <typename ...Keys>
+        struct string_table {
+            static constexpr detail::std::size_t N = sizeof...(Keys);
+
+            // We put a trailing element only to avoid empty arrays.
+            static constexpr char const* strings[] = {
+                key_info<Keys>::value..., nullptr
+            };
+            static constexpr detail::std::size_t lengths[] = {
+                key_info<Keys>::size..., 0
+            };
+
+            static constexpr perfect_hash<sizeof...(Keys)> table = make_perfect_hash<N>({{
+                string_detail::hash(key_info<Keys>::value, key_info<Keys>::size)...
+            }});
+
+            static_assert(table.found,
+            "hana::string_switch(map) could not find a perfect hash function "
+            "for the keys of 'map'");
+
+            // Returns the index of the key equal to the given string, or
+            // `N` if there is no such key.
+            static detail::std::size_t find(char const* s, detail::std::size_t n) {
+                detail::std::size_t i = table.slots[
+                    table.slot(string_detail::hash(s, n))
+                ];
+                return i != N && lengths[i] == n &&
+                       (n == 0 || string_detail::equal_chars(strings[i], s, n))
+                            ? i : N;
+            }
+        };
+
+        template <typename ...Keys>
+        constexpr char const* string_table<Keys...>::strings[];
+
+        template <typename ...Keys>
+        constexpr detail::std::size_t string_table<Keys...>::lengths[];
+
+        template <typename ...Keys>
+        constexpr perfect_hash<sizeof...(Keys)> string_table<Keys...>::table;
+
+        struct make_string_table {
+            template <typename ...Pairs>
+            constexpr string_table<
+                typename detail::std::decay<decltype(hana::first(
+                    detail::std::declval<Pairs>()
+                ))>::type...
+            > operator()(Pairs&& ...) const { return {}; }
+        };
+
+        template <typename F>
+        struct call_with_value {
+            F& f;
+
+            // `second` returns the value by value, so the value of a `_pair`
+            // is passed by reference directly from its storage instead.
+            template <typename First, typename Second>
+            constexpr decltype(auto)
+            operator()(_pair<First, Second> const& pair) const
+            { return f(detail::get<1>(pair.storage)); }
+
+            template <typename Pair>
+            constexpr decltype(auto) operator()(Pair&& pair) const
+            { return f(hana::second(static_cast<Pair&&>(pair))); }
+        };
+
+        template <typename Map>
+        struct switcher {
+            Map map;
+
+            using Table = decltype(hana::unpack(
+                detail::std::declval<Map const&>(), make_string_table{}
+            ));
+
+            template <typename F, typename Fallback>
+            decltype(auto) operator()(char const* s, detail::std::size_t length,
+                                      F&& f, Fallback&& fallback) const
+            {
+                return hana::visit_at(map, Table::find(s, length),
+                                      call_with_value<F>{f},
+                                      static_cast<Fallback&&>(fallback));
+            }
+
+            template <typename S, typename F, typename Fallback>
+            decltype(auto) operator()(S const& s, F&& f, Fallback&& fallback) const {
+                return (*this)(s.data(), s.size(), static_cast<F&&>(f),
+                               static_cast<Fallback&&>(fallback));
+            }
+        };
+    }
+
+    //! @cond
+    template <typename Map>
+    constexpr auto _string_switch::operator()(Map&& map) const {
+        return string_detail::switcher<typename detail::std::decay<Map>::type>{
+            static_cast<Map&&>(map)
+        };
+    }
+    //! @endcond
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_STRING_HPP
@@ -18,10 +18,16 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/default.hpp>
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/jump_table.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
 #include <boost/hana/foldable.hpp>
 #include <boost/hana/functional/compose.hpp>
 #include <boost/hana/functional/partial.hpp>
 #include <boost/hana/functor.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/iterable.hpp>
 #include <boost/hana/pair.hpp>
 #include <boost/hana/searchable.hpp>
 
@@ -159,6 +165,42 @@ namespace boost { namespace hana {
         }
     };
 
+    namespace struct_detail {
+        // Creates a pair holding the key of the n-th member and a reference
+        // to that member, so the member is never copied.
+        template <typename S>
+        struct get_member_pair {
+            template <detail::std::size_t n, typename Udt>
+            static constexpr auto apply(Udt&& udt) {
+                auto accessor = hana::at_c<n>(hana::accessors<S>());
+                using Key = typename detail::std::decay<
+                    decltype(hana::first(accessor))
+                >::type;
+                using Member = decltype(
+                    hana::second(accessor)(static_cast<Udt&&>(udt))
+                );
+                return _pair<Key, Member>{hana::first(accessor),
+                    hana::second(accessor)(static_cast<Udt&&>(udt))};
+            }
+        };
+    }
+
+    // Unlike with `unpack`, the members are not copied into pairs; the
+    // visited member is passed by reference instead.
+    template <typename S>
+    struct visit_at_with_index_impl<S, when<_models<Struct, S>{}()>> {
+        template <typename Udt, typename F, typename Fallback>
+        static constexpr decltype(auto)
+        apply(Udt&& udt, detail::std::size_t i, F&& f, Fallback&& fallback) {
+            constexpr detail::std::size_t n = hana::value<
+                decltype(hana::length(hana::accessors<S>()))
+            >();
+            return detail::jump_table<struct_detail::get_member_pair<S>,
+                Udt, F, Fallback, detail::std::make_index_sequence<n>
+            >::apply(udt, i, f, fallback);
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Model of Searchable
     //////////////////////////////////////////////////////////////////////////
@@ -14,6 +14,7 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/bool.hpp>
 #include <boost/hana/comparable.hpp>
+#include <boost/hana/config.hpp>
 #include <boost/hana/constant.hpp>
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/operators.hpp>
@@ -22,6 +23,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/constexpr/algorithm.hpp>
 #include <boost/hana/detail/constexpr/array.hpp>
 #include <boost/hana/detail/generate_integer_sequence.hpp>
+#include <boost/hana/detail/jump_table.hpp>
+#include <boost/hana/detail/std/conditional.hpp>
 #include <boost/hana/detail/std/decay.hpp>
 #include <boost/hana/detail/std/declval.hpp>
 #include <boost/hana/detail/std/enable_if.hpp>
@@ -32,6 +35,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/std/size_t.hpp>
 #include <boost/hana/detail/type_foldl1.hpp>
 #include <boost/hana/detail/type_foldr1.hpp>
+#include <boost/hana/detail/variadic/fold_balanced.hpp>
 #include <boost/hana/detail/variadic/foldl1.hpp>
 #include <boost/hana/detail/variadic/foldr1.hpp>
 #include <boost/hana/foldable.hpp>
@@ -58,7 +62,7 @@ namespace boost { namespace hana {
     template <typename ...Xs>
     struct _tuple
         : detail::closure<Xs...>
-        , operators::adl
+        , operators::adl_for<_tuple<Xs...>>
         , operators::Iterable_ops<_tuple<Xs...>>
     {
         using detail::closure<Xs...>::closure; // inherit constructor
@@ -66,6 +70,34 @@ namespace boost { namespace hana {
         _tuple(_tuple&&) = default;
         _tuple(_tuple const&) = default;
         _tuple(_tuple&) = default;
+        _tuple& operator=(_tuple const&) = default;
+        _tuple& operator=(_tuple&&) = default;
+
+        // Assigns each element of a tuple of the same length to the
+        // corresponding element of this tuple. In particular, this assigns
+        // to the objects referred to by a tuple returned by `tie`.
+        template <typename ...Ys, typename = decltype(detail::swallow(
+            (void(detail::std::declval<Xs&>() =
+                  detail::std::declval<Ys const&>()), 0)...
+        ))>
+        constexpr _tuple& operator=(_tuple<Ys...> const& ys) {
+            assign(ys, detail::std::make_index_sequence<sizeof...(Xs)>{});
+            return *this;
+        }
+
+        template <typename ...Ys, typename = decltype(detail::swallow(
+            (void(detail::std::declval<Xs&>() =
+                  detail::std::declval<Ys&&>()), 0)...
+        ))>
+        constexpr _tuple& operator=(_tuple<Ys...>&& ys) {
+            assign(detail::std::move(ys),
+                   detail::std::make_index_sequence<sizeof...(Xs)>{});
+            return *this;
+        }
+
+        // Elements may be inherited from (see `detail::closure`), so we make
+        // sure their own `operator[]`, if any, is hidden.
+        using operators::Iterable_ops<_tuple<Xs...>>::operator[];
 
         using hana = _tuple;
         using datatype = Tuple;
@@ -73,6 +105,15 @@ namespace boost { namespace hana {
         static constexpr detail::std::size_t size = sizeof...(Xs);
         static constexpr bool is_tuple_t = false;
         static constexpr bool is_tuple_c = false;
+
+    private:
+        template <typename Ys, detail::std::size_t ...i>
+        constexpr void assign(Ys&& ys, detail::std::index_sequence<i...>) {
+            using Swallow = int[];
+            (void)Swallow{0, (void(
+                detail::get<i>(*this) = detail::get<i>(static_cast<Ys&&>(ys))
+            ), 0)...};
+        }
     };
 
     template <typename T, T ...v>
@@ -138,9 +179,46 @@ namespace boost { namespace hana {
                 detail::std::make_index_sequence<indices.size()>{});
         }
 
+        // Generates the indices of a tuple of size `n`, except `i`.
+        template <detail::std::size_t n, detail::std::size_t i>
+        struct indices_without {
+            static constexpr auto apply() {
+                detail::constexpr_::array<detail::std::size_t, n - 1> indices{};
+                for (detail::std::size_t k = 0; k < n - 1; ++k)
+                    indices[k] = k < i ? k : k + 1;
+                return indices;
+            }
+        };
+
+        // Elements held by value are copied or moved into a subsequence,
+        // but lvalue references are kept as-is. Hence, a subsequence of a
+        // tuple created with `tie` refers to the same objects.
+        template <typename X>
+        struct subsequence_element
+        { using type = typename detail::std::decay<X>::type; };
+
+        template <typename X>
+        struct subsequence_element<X&>
+        { using type = X&; };
+
+        template <detail::std::size_t n, typename X, bool ebo>
+        subsequence_element<X>
+        subsequence_element_at(detail::element<n, X, ebo> const&);
+
+        template <detail::std::size_t n, typename Xs>
+        using subsequence_element_t = typename decltype(
+            tuple_detail::subsequence_element_at<n>(detail::std::declval<Xs>())
+        )::type;
+
         template <typename Xs, detail::std::size_t ...i>
-        constexpr auto get_subsequence(Xs&& xs, detail::std::index_sequence<i...>) {
-            return hana::make_tuple(detail::get<i>(static_cast<Xs&&>(xs))...);
+        constexpr _tuple<subsequence_element_t<i, Xs>...>
+        get_subsequence(Xs&& xs, detail::std::index_sequence<i...>)
+        { return {detail::get<i>(static_cast<Xs&&>(xs))...}; }
+
+        template <detail::std::size_t from, typename Xs, detail::std::size_t ...i>
+        constexpr auto get_slice(Xs&& xs, detail::std::index_sequence<i...>) {
+            return tuple_detail::get_subsequence(static_cast<Xs&&>(xs),
+                    detail::std::index_sequence<from + i...>{});
         }
     }
 
@@ -168,6 +246,126 @@ namespace boost { namespace hana {
         MACRO(&&    , &&    , &&    )                                   \
     /**/
 
+    namespace tuple_detail {
+        // Kinds of `Logical` values returned by the comparison of two
+        // elements, or by a predicate applied to an element.
+        constexpr int ct_false = 0;
+        constexpr int ct_true = 1;
+        constexpr int runtime = 2;
+
+        template <typename L, bool = _models<Constant, L>{}()>
+        struct logical_kind {
+            static constexpr int value = runtime;
+        };
+
+        template <typename L>
+        struct logical_kind<L, true> {
+            static constexpr int value = hana::value<L>() ? ct_true : ct_false;
+        };
+
+        // Returns the kind of the conjunction of `Logical`s of the given
+        // kinds.
+        template <detail::std::size_t N>
+        constexpr int all_of_kind(int const (&kinds)[N]) {
+            int result = ct_true;
+            for (detail::std::size_t i = 0; i < N; ++i) {
+                if (kinds[i] == ct_false)
+                    return ct_false;
+                else if (kinds[i] == runtime)
+                    result = runtime;
+            }
+            return result;
+        }
+
+        // Computes the kinds of the `Logical`s returned by a predicate for
+        // each element of a tuple. The predicate is never called; only the
+        // type of its result is used.
+        template <typename Pred, typename ...X>
+        struct predicate_kinds {
+            static constexpr auto apply() {
+                return detail::constexpr_::array<int, sizeof...(X)>{{
+                    logical_kind<typename detail::std::decay<decltype(
+                        detail::std::declval<Pred>()(detail::std::declval<X>())
+                    )>::type>::value...
+                }};
+            }
+        };
+
+        template <typename Pred, typename ...Xs>
+        predicate_kinds<Pred, typename Xs::get_type...>
+        predicate_kinds_of(detail::closure_impl<Xs...> const&);
+
+        // Same as `predicate_kinds`, but stops at the first element which
+        // satisfies the predicate at compile-time, whose kind is the last
+        // one. The predicate is not applied to the following elements,
+        // which may not even be valid arguments for it.
+        template <typename Pred, typename X>
+        struct predicate_kind {
+            static constexpr int value = logical_kind<
+                typename detail::std::decay<decltype(
+                    detail::std::declval<Pred>()(detail::std::declval<X>())
+                )>::type
+            >::value;
+        };
+
+        template <typename Pred, typename Kinds, typename ...X>
+        struct predicate_kinds_until_true;
+
+        template <typename Pred, int ...k>
+        struct predicate_kinds_until_true<
+            Pred, detail::std::integer_sequence<int, k...>
+        > {
+            static constexpr auto apply() {
+                return detail::constexpr_::array<int, sizeof...(k)>{{k...}};
+            }
+        };
+
+        template <typename Pred, int ...k, typename X, typename ...Xs>
+        struct predicate_kinds_until_true<
+            Pred, detail::std::integer_sequence<int, k...>, X, Xs...
+        >
+            : detail::std::conditional_t<
+                predicate_kind<Pred, X>::value == ct_true,
+                predicate_kinds_until_true<Pred,
+                    detail::std::integer_sequence<int, k..., ct_true>
+                >,
+                predicate_kinds_until_true<Pred,
+                    detail::std::integer_sequence<int, k...,
+                        predicate_kind<Pred, X>::value
+                    >,
+                    Xs...
+                >
+            >
+        { };
+
+        template <typename Pred, typename ...Xs>
+        predicate_kinds_until_true<Pred, detail::std::integer_sequence<int>,
+                                   typename Xs::get_type...>
+        predicate_kinds_until_true_of(detail::closure_impl<Xs...> const&);
+
+        // Returns the index of the first kind which is not `ct_false`, or
+        // the number of kinds if there is none.
+        template <typename Kinds>
+        constexpr detail::std::size_t first_not_false(Kinds const& kinds) {
+            detail::std::size_t i = 0;
+            while (i < kinds.size() && kinds[i] == ct_false)
+                ++i;
+            return i;
+        }
+
+        // Returns the kind of the disjunction of `Logical`s of the given
+        // kinds.
+        template <typename Kinds>
+        constexpr int any_of_kind(Kinds const& kinds) {
+            using detail::constexpr_::find;
+            return find(kinds.begin(), kinds.end(), ct_true) != kinds.end()
+                        ? ct_true
+                 : find(kinds.begin(), kinds.end(), runtime) != kinds.end()
+                        ? runtime
+                        : ct_false;
+        }
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Comparable
     //////////////////////////////////////////////////////////////////////////
@@ -190,31 +388,61 @@ namespace boost { namespace hana {
         }
 
         // tuple
-        template <detail::std::size_t i, detail::std::size_t n>
-        struct equal_tuple {
-            template <typename Xs, typename Ys>
-            constexpr decltype(auto) operator()(Xs const* xs, Ys const* ys) const {
-                return hana::eval_if(
-                    hana::equal(detail::get<i>(*xs), detail::get<i>(*ys)),
-                    hana::lazy(equal_tuple<i+1, n>{})(xs, ys),
-                    hana::lazy(false_)
-                );
-            }
-        };
+        template <typename Xs, typename Ys, detail::std::size_t ...i>
+        static constexpr auto
+        equal_tuple(Xs const&, Ys const&, detail::std::index_sequence<i...>,
+                    _integral_constant<int, tuple_detail::ct_false>)
+        { return false_; }
 
-        template <detail::std::size_t n>
-        struct equal_tuple<n, n> {
-            constexpr auto operator()(...) const
-            { return true_; }
-        };
+        template <typename Xs, typename Ys, detail::std::size_t ...i>
+        static constexpr auto
+        equal_tuple(Xs const&, Ys const&, detail::std::index_sequence<i...>,
+                    _integral_constant<int, tuple_detail::ct_true>)
+        { return true_; }
+
+        template <typename Xs, typename Ys, detail::std::size_t ...i>
+        static constexpr bool
+        equal_tuple(Xs const& xs, Ys const& ys, detail::std::index_sequence<i...>,
+                    _integral_constant<int, tuple_detail::runtime>)
+        {
+#ifdef BOOST_HANA_CONFIG_HAS_CXX1Z_FOLD_EXPRESSIONS
+            return (... && hana::if_(
+                hana::equal(detail::get<i>(xs), detail::get<i>(ys)), true, false
+            ));
+#else
+            bool result = true;
+            using Swallow = bool[];
+            (void)Swallow{true, (result = result && hana::if_(
+                hana::equal(detail::get<i>(xs), detail::get<i>(ys)), true, false
+            ))...};
+            return result;
+#endif
+        }
+
+        // The comparisons whose result is known at compile-time are folded
+        // into a single `bool_`. Otherwise, the elements are compared at
+        // runtime in a single short-circuiting chain.
+        template <typename Xs, typename Ys, detail::std::size_t ...i>
+        static constexpr auto
+        equal_tuple(Xs const& xs, Ys const& ys, detail::std::index_sequence<i...> is) {
+            constexpr int kinds[] = {
+                tuple_detail::logical_kind<decltype(
+                    hana::equal(detail::get<i>(xs), detail::get<i>(ys))
+                )>::value...
+            };
+            constexpr int kind = tuple_detail::all_of_kind(kinds);
+            return equal_tuple(xs, ys, is, _integral_constant<int, kind>{});
+        }
 
         template <typename Xs, typename Ys, typename = detail::std::enable_if_t<
             (Xs::size == Ys::size && Xs::size != 0) &&
             !(Xs::is_tuple_t && Ys::is_tuple_t) &&
             !(Xs::is_tuple_c && Ys::is_tuple_c)
         >>
-        static constexpr decltype(auto) apply(Xs const& xs, Ys const& ys)
-        { return equal_tuple<0, Xs::size>{}(&xs, &ys); }
+        static constexpr decltype(auto) apply(Xs const& xs, Ys const& ys) {
+            return equal_tuple(xs, ys,
+                            detail::std::make_index_sequence<Xs::size>{});
+        }
 
 
         // empty tuples and tuples with different sizes
@@ -225,6 +453,102 @@ namespace boost { namespace hana {
         { return bool_<Xs::size == 0 && Ys::size == 0>; }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Orderable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct less_impl<Tuple, Tuple> {
+        // The elements are compared lexicographically using `less` only, so
+        // they need not be `Comparable`. The comparisons following the first
+        // pair of elements known to be different at compile-time are never
+        // instantiated, and the comparisons made at runtime stop at the
+        // first pair of different elements.
+        template <detail::std::size_t i, detail::std::size_t n,
+                  typename Xs, typename Ys>
+        static constexpr auto
+        less_from(Xs const&, Ys const&, decltype(true_) /* i == n */)
+        { return bool_<(Xs::size < Ys::size)>; }
+
+        template <detail::std::size_t i, detail::std::size_t n,
+                  typename Xs, typename Ys>
+        static constexpr auto
+        less_from(Xs const& xs, Ys const& ys, decltype(false_) /* i == n */) {
+            using Less = decltype(
+                hana::less(detail::get<i>(xs), detail::get<i>(ys))
+            );
+            return less_at<i, n>(xs, ys,
+                _integral_constant<int, tuple_detail::logical_kind<Less>::value>{});
+        }
+
+        // `xs[i] < ys[i]`
+        template <detail::std::size_t i, detail::std::size_t n,
+                  typename Xs, typename Ys>
+        static constexpr auto
+        less_at(Xs const&, Ys const&,
+                _integral_constant<int, tuple_detail::ct_true>)
+        { return true_; }
+
+        template <detail::std::size_t i, detail::std::size_t n,
+                  typename Xs, typename Ys>
+        static constexpr auto
+        less_at(Xs const& xs, Ys const& ys,
+                _integral_constant<int, tuple_detail::ct_false>)
+        {
+            using Greater = decltype(
+                hana::less(detail::get<i>(ys), detail::get<i>(xs))
+            );
+            return greater_at<i, n>(xs, ys,
+                _integral_constant<int, tuple_detail::logical_kind<Greater>::value>{});
+        }
+
+        template <detail::std::size_t i, detail::std::size_t n,
+                  typename Xs, typename Ys>
+        static constexpr bool
+        less_at(Xs const& xs, Ys const& ys,
+                _integral_constant<int, tuple_detail::runtime>)
+        {
+            return hana::if_(
+                hana::less(detail::get<i>(xs), detail::get<i>(ys)), true, false
+            ) || hana::if_(less_at<i, n>(xs, ys,
+                    _integral_constant<int, tuple_detail::ct_false>{}),
+                true, false);
+        }
+
+        // `ys[i] < xs[i]`, knowing that `!(xs[i] < ys[i])`
+        template <detail::std::size_t i, detail::std::size_t n,
+                  typename Xs, typename Ys>
+        static constexpr auto
+        greater_at(Xs const&, Ys const&,
+                   _integral_constant<int, tuple_detail::ct_true>)
+        { return false_; }
+
+        template <detail::std::size_t i, detail::std::size_t n,
+                  typename Xs, typename Ys>
+        static constexpr auto
+        greater_at(Xs const& xs, Ys const& ys,
+                   _integral_constant<int, tuple_detail::ct_false>)
+        { return less_from<i + 1, n>(xs, ys, bool_<(i + 1 == n)>); }
+
+        template <detail::std::size_t i, detail::std::size_t n,
+                  typename Xs, typename Ys>
+        static constexpr bool
+        greater_at(Xs const& xs, Ys const& ys,
+                   _integral_constant<int, tuple_detail::runtime>)
+        {
+            return !hana::if_(
+                hana::less(detail::get<i>(ys), detail::get<i>(xs)), true, false
+            ) && hana::if_(less_from<i + 1, n>(xs, ys, bool_<(i + 1 == n)>),
+                           true, false);
+        }
+
+        template <typename Xs, typename Ys>
+        static constexpr auto apply(Xs const& xs, Ys const& ys) {
+            constexpr detail::std::size_t n = Xs::size < Ys::size ? Xs::size
+                                                                  : Ys::size;
+            return less_from<0, n>(xs, ys, bool_<(n == 0)>);
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Foldable
     //////////////////////////////////////////////////////////////////////////
@@ -240,8 +564,11 @@ namespace boost { namespace hana {
             #define BOOST_HANA_PP_UNPACK(REF)                                   \
                 template <typename ...Xs, typename F>                           \
                 constexpr decltype(auto)                                        \
-                operator()(detail::closure_impl<Xs...> REF xs, F&& f) const     \
-                { return static_cast<F&&>(f)(static_cast<Xs REF>(xs).get...); } \
+                operator()(detail::closure_impl<Xs...> REF xs, F&& f) const {   \
+                    return static_cast<F&&>(f)(                                 \
+                        detail::get(static_cast<Xs REF>(xs))...                 \
+                    );                                                          \
+                }                                                               \
             /**/
             BOOST_HANA_PP_FOR_EACH_REF1(BOOST_HANA_PP_UNPACK)
             #undef BOOST_HANA_PP_UNPACK
@@ -266,7 +593,7 @@ namespace boost { namespace hana {
                     return detail::variadic::foldl1(                            \
                         static_cast<F&&>(f),                                    \
                         static_cast<S&&>(s),                                    \
-                        static_cast<Xs REF>(xs).get...                          \
+                        detail::get(static_cast<Xs REF>(xs))...                 \
                     );                                                          \
                 }                                                               \
             /**/
@@ -300,7 +627,7 @@ namespace boost { namespace hana {
                 operator()(detail::closure_impl<Xs...> REF xs, F&& f) const {   \
                     return detail::variadic::foldl1(                            \
                         static_cast<F&&>(f),                                    \
-                        static_cast<Xs REF>(xs).get...                          \
+                        detail::get(static_cast<Xs REF>(xs))...                 \
                     );                                                          \
                 }                                                               \
             /**/
@@ -333,7 +660,7 @@ namespace boost { namespace hana {
                 operator()(detail::closure_impl<Xs...> REF xs, S&& s, F&& f) const {\
                     return detail::variadic::foldr1(                            \
                         static_cast<F&&>(f),                                    \
-                        static_cast<Xs REF>(xs).get...,                         \
+                        detail::get(static_cast<Xs REF>(xs))...,                \
                         static_cast<S&&>(s)                                     \
                     );                                                          \
                 }                                                               \
@@ -368,7 +695,7 @@ namespace boost { namespace hana {
                 operator()(detail::closure_impl<Xs...> REF xs, F&& f) const {\
                     return detail::variadic::foldr1(                         \
                         static_cast<F&&>(f),                                 \
-                        static_cast<Xs REF>(xs).get...                       \
+                        detail::get(static_cast<Xs REF>(xs))...              \
                     );                                                       \
                 }                                                            \
             /**/
@@ -392,6 +719,59 @@ namespace boost { namespace hana {
         }
     };
 
+    template <>
+    struct fold_balanced_nostate_impl<Tuple> {
+        // For a `tuple_c` folded with `plus` or `mult`, the values are
+        // combined in a constexpr loop, which instantiates nothing per
+        // element. Both operations are associative, so the result is the
+        // same as when combining the `integral_constant`s pairwise.
+        struct fold_balanced_tuple_c {
+            template <typename T, typename F, detail::std::size_t n>
+            static constexpr T fold_values(F const& f, T const (&values)[n]) {
+                T result = values[0];
+                for (detail::std::size_t i = 1; i < n; ++i)
+                    result = f(result, values[i]);
+                return result;
+            }
+
+            template <typename T, T v1, T ...vn>
+            constexpr auto
+            operator()(_tuple_c<T, v1, vn...> const&, _plus const&) const {
+                constexpr T values[] = {v1, vn...};
+                return _integral_constant<T, fold_values(_plus{}, values)>{};
+            }
+
+            template <typename T, T v1, T ...vn>
+            constexpr auto
+            operator()(_tuple_c<T, v1, vn...> const&, _mult const&) const {
+                constexpr T values[] = {v1, vn...};
+                return _integral_constant<T, fold_values(_mult{}, values)>{};
+            }
+        };
+
+        // Otherwise, the elements of the tuple are combined pairwise
+        // directly from its storage.
+        struct fold_balanced_tuple {
+            template <typename Xs, typename F>
+            constexpr auto operator()(Xs&& xs, F&& f) const {
+                constexpr detail::std::size_t n = tuple_detail::size<Xs>{}();
+                static_assert(n != 0,
+                "hana::fold.balanced(xs, f) requires xs to be non-empty");
+                using Impl = detail::variadic::fold_balanced_detail::
+                                fold_balanced_impl<n>;
+                return Impl::apply(f, static_cast<Xs&&>(xs));
+            }
+        };
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            return overload_linearly(
+                fold_balanced_tuple_c{},
+                fold_balanced_tuple{}
+            )(static_cast<Xs&&>(xs), static_cast<F&&>(f));
+        }
+    };
+
     template <>
     struct length_impl<Tuple> {
         template <typename Xs>
@@ -399,6 +779,60 @@ namespace boost { namespace hana {
         { return {}; }
     };
 
+    template <>
+    struct count_if_impl<Tuple> {
+        template <typename Xs, typename Pred, typename Kinds>
+        static constexpr auto count_tuple(Xs&&, Pred&&, Kinds, decltype(true_)) {
+            constexpr auto kinds = Kinds::apply();
+            return size_t<detail::constexpr_::count(
+                kinds.begin(), kinds.end(), tuple_detail::ct_true
+            )>;
+        }
+
+        template <typename Xs, typename Pred, typename Kinds>
+        static constexpr decltype(auto)
+        count_tuple(Xs&& xs, Pred&& pred, Kinds, decltype(false_)) {
+            return count_if_impl<Tuple, when<true>>::apply(
+                static_cast<Xs&&>(xs), static_cast<Pred&&>(pred));
+        }
+
+        // When the predicate returns compile-time `Logical`s only, the
+        // count is computed from the table of its results. Otherwise, we
+        // fall back to the default implementation.
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            using Kinds = decltype(
+                tuple_detail::predicate_kinds_of<Pred&&>(xs)
+            );
+            constexpr auto kinds = Kinds::apply();
+            constexpr bool ct = detail::constexpr_::find(
+                kinds.begin(), kinds.end(), tuple_detail::runtime
+            ) == kinds.end();
+            return count_if_impl::count_tuple(static_cast<Xs&&>(xs),
+                                              static_cast<Pred&&>(pred),
+                                              Kinds{}, bool_<ct>);
+        }
+    };
+
+    namespace tuple_detail {
+        struct get_element {
+            template <detail::std::size_t n, typename Xs>
+            static constexpr decltype(auto) apply(Xs&& xs)
+            { return detail::get<n>(static_cast<Xs&&>(xs)); }
+        };
+    }
+
+    template <>
+    struct visit_at_with_index_impl<Tuple> {
+        template <typename Xs, typename F, typename Fallback>
+        static constexpr decltype(auto)
+        apply(Xs&& xs, detail::std::size_t i, F&& f, Fallback&& fallback) {
+            return detail::jump_table<tuple_detail::get_element, Xs, F, Fallback,
+                detail::std::make_index_sequence<tuple_detail::size<Xs>::value>
+            >::apply(xs, i, f, fallback);
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Iterable
     //////////////////////////////////////////////////////////////////////////
@@ -418,6 +852,11 @@ namespace boost { namespace hana {
         }
     };
 
+    template <>
+    struct random_access<Tuple>
+        : _integral_constant<bool, true>
+    { };
+
     template <>
     struct tail_impl<Tuple> {
         struct tail_tuple {
@@ -425,7 +864,7 @@ namespace boost { namespace hana {
                 template <typename X, typename ...Xn>                       \
                 constexpr _tuple<typename Xn::get_type...>                  \
                 operator()(detail::closure_impl<X, Xn...> REF xs) const {   \
-                    return {static_cast<Xn REF>(xs).get...};                \
+                    return {detail::get(static_cast<Xn REF>(xs))...};       \
                 }                                                           \
             /**/
             BOOST_HANA_PP_FOR_EACH_REF1(BOOST_HANA_PP_TAIL)
@@ -467,18 +906,12 @@ namespace boost { namespace hana {
     struct drop_at_most_impl<Tuple> {
         using Size = detail::std::size_t;
 
-        template <Size n, typename Xs, Size ...i>
-        static constexpr decltype(auto)
-        drop_helper(Xs&& xs, detail::std::index_sequence<i...>) {
-            return hana::make<Tuple>(detail::get<n + i>(static_cast<Xs&&>(xs))...);
-        }
-
         template <typename Xs, typename N>
         static constexpr decltype(auto) apply(Xs&& xs, N const&) {
             constexpr Size n = hana::value<N>();
             constexpr Size size = tuple_detail::size<Xs>{}();
             constexpr Size drop_size = n > size ? size : n;
-            return drop_helper<drop_size>(static_cast<Xs&&>(xs),
+            return tuple_detail::get_slice<drop_size>(static_cast<Xs&&>(xs),
                 detail::std::make_index_sequence<size - drop_size>{});
         }
     };
@@ -535,105 +968,147 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     // Searchable
     //////////////////////////////////////////////////////////////////////////
-    namespace tuple_detail {
-        template <typename Xs, typename Pred, typename = hana::when<true>>
-        struct find_tail_size;
-
-        template <typename Pred>
-        struct find_tail_size<hana::_tuple<>, Pred> { };
-
-        template <typename X, typename ...Xs, typename Pred>
-        struct find_tail_size<hana::_tuple<X, Xs...>, Pred, hana::when<
-            hana::if_(hana::value<decltype(
-                detail::std::declval<Pred>()(detail::std::declval<X>())
-            )>(), true, false)
-        >> {
-            static constexpr auto value = sizeof...(Xs);
-        };
+    template <>
+    struct find_if_impl<Tuple> {
+        template <typename Xs, detail::std::size_t i>
+        static constexpr auto
+        find_tuple(Xs&& xs, _integral_constant<detail::std::size_t, i>,
+                   decltype(true_))
+        { return hana::just(hana::at_c<i>(static_cast<Xs&&>(xs))); }
 
-        template <typename X, typename ...Xs, typename Pred>
-        struct find_tail_size<hana::_tuple<X, Xs...>, Pred, hana::when<
-            !hana::if_(hana::value<decltype(
-                detail::std::declval<Pred>()(detail::std::declval<X>())
-            )>(), true, false)
-        >>
-            : find_tail_size<hana::_tuple<Xs...>, Pred>
-        { };
+        template <typename Xs, typename I>
+        static constexpr auto find_tuple(Xs&&, I, decltype(false_))
+        { return hana::nothing; }
 
-        template <typename Xs, typename Pred,
-            detail::std::size_t tail_size = find_tail_size<
-                typename detail::std::remove_cv<
-                    typename detail::std::remove_reference<Xs>::type
-                >::type, Pred
-            >::value
-        >
-        constexpr auto find_if_impl(Xs&& xs, Pred const&, int) {
-            constexpr auto size = tuple_detail::size<Xs>::value;
-            constexpr auto index = size - tail_size - 1;
-            return hana::just(hana::at_c<index>(static_cast<Xs&&>(xs)));
+        // The index of the first element satisfying the predicate is found
+        // with a single lookup in the table of the predicate's results.
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&&) {
+            using Kinds = decltype(
+                tuple_detail::predicate_kinds_until_true_of<Pred&&>(xs)
+            );
+            constexpr auto kinds = Kinds::apply();
+            constexpr detail::std::size_t index =
+                                        tuple_detail::first_not_false(kinds);
+            constexpr bool found = index != kinds.size();
+            static_assert(!found || kinds[index] == tuple_detail::ct_true,
+            "hana::find_if(xs, pred) requires pred to return a compile-time Logical");
+
+            return find_if_impl::find_tuple(static_cast<Xs&&>(xs),
+                                            size_t<index>, bool_<found>);
         }
+    };
 
-        template <typename Xs, typename Pred>
-        constexpr auto find_if_impl(Xs&&, Pred const&, long)
-        { return hana::nothing; }
-    }
+    // `any_of_runtime` is only used when none of the elements satisfies the
+    // predicate at compile-time, and at least one of them may satisfy it at
+    // runtime. The predicate is then applied from left to right until an
+    // element satisfies it, and the result is a `bool`.
+#ifdef BOOST_HANA_CONFIG_HAS_CXX1Z_FOLD_EXPRESSIONS
+    namespace tuple_detail {
+        // State of the fold-expression used to implement `any_of`, where
+        // `cond` is the result for the elements seen so far. Once it is
+        // `true`, the predicate is not applied to the remaining elements.
+        template <typename Pred>
+        struct any_of_state {
+            bool cond;
+            Pred& pred;
+
+            template <typename X>
+            constexpr any_of_state operator|(X& x) && {
+                return {cond || hana::if_(pred(detail::get(x)), true, false),
+                        pred};
+            }
+        };
 
-    template <>
-    struct find_if_impl<Tuple> {
-        #define BOOST_HANA_PP_FIND_IF(REF)                                  \
-            template <typename ...Xs, typename Pred>                        \
-            static constexpr decltype(auto)                                 \
-            apply(_tuple<Xs...> REF xs, Pred&& pred) {                      \
-                return tuple_detail::find_if_impl(                          \
-                    static_cast<_tuple<Xs...> REF>(xs),                     \
-                    static_cast<Pred&&>(pred), int{});                      \
-            }                                                               \
-        /**/
-        BOOST_HANA_PP_FOR_EACH_REF1(BOOST_HANA_PP_FIND_IF)
-        #undef BOOST_HANA_PP_FIND_IF
-    };
+        struct any_of_runtime {
+            template <typename ...Xs, typename Pred>
+            static constexpr bool
+            any_of_closure(detail::closure_impl<Xs...> const& xs, Pred& pred) {
+                using State = any_of_state<Pred>;
+                return (State{false, pred} | ... | static_cast<Xs const&>(xs)).cond;
+            }
 
-    template <>
-    struct any_of_impl<Tuple> {
-        template <detail::std::size_t k, detail::std::size_t Len>
-        struct any_of_helper {
-            template <typename Xs, typename Pred>
-            static constexpr auto apply(bool prev_cond, Xs&& xs, Pred&& pred) {
-                auto cond = hana::if_(pred(at_c<k>(xs)), true_, false_);
-                return prev_cond ? true_
-                    : any_of_impl::any_of_helper<k + 1, Len>::apply(cond,
-                                        static_cast<Xs&&>(xs),
-                                        static_cast<Pred&&>(pred));
+            template <typename ...Xs, typename Pred>
+            static constexpr bool
+            any_of_closure(detail::closure_impl<Xs...>& xs, Pred& pred) {
+                using State = any_of_state<Pred>;
+                return (State{false, pred} | ... | static_cast<Xs&>(xs)).cond;
             }
 
             template <typename Xs, typename Pred>
-            static constexpr auto apply(decltype(true_), Xs&&, Pred&&)
-            { return true_; }
+            static constexpr bool apply(Xs&& xs, Pred&& pred)
+            { return any_of_runtime::any_of_closure(xs, pred); }
+        };
+    }
+#else
+    namespace tuple_detail {
+        struct any_of_runtime {
+            template <detail::std::size_t k, detail::std::size_t Len>
+            struct any_of_helper {
+                template <typename Xs, typename Pred>
+                static constexpr bool apply(Xs&& xs, Pred&& pred) {
+                    return hana::if_(pred(hana::at_c<k>(xs)), true, false) ||
+                        any_of_runtime::any_of_helper<k + 1, Len>::apply(
+                                            static_cast<Xs&&>(xs),
+                                            static_cast<Pred&&>(pred));
+                }
+            };
+
+            template <detail::std::size_t Len>
+            struct any_of_helper<Len, Len> {
+                template <typename Xs, typename Pred>
+                static constexpr bool apply(Xs&&, Pred&&)
+                { return false; }
+            };
 
             template <typename Xs, typename Pred>
-            static constexpr auto apply(decltype(false_), Xs&& xs, Pred&& pred) {
-                auto cond = hana::if_(pred(hana::at_c<k>(xs)), true_, false_);
-                return any_of_impl::any_of_helper<k + 1, Len>::apply(cond,
-                                        static_cast<Xs&&>(xs),
-                                        static_cast<Pred&&>(pred));
+            static constexpr bool apply(Xs&& xs, Pred&& pred) {
+                constexpr detail::std::size_t len = hana::value<
+                    decltype(hana::length(xs))
+                >();
+                return any_of_runtime::any_of_helper<0, len>::apply(
+                                                static_cast<Xs&&>(xs),
+                                                static_cast<Pred&&>(pred));
             }
         };
+    }
+#endif
 
-        template <detail::std::size_t Len>
-        struct any_of_helper<Len, Len> {
-            template <typename Cond, typename Xs, typename Pred>
-            static constexpr auto apply(Cond cond, Xs&&, Pred&&)
-            { return cond; }
-        };
+    template <>
+    struct any_of_impl<Tuple> {
+        template <typename Xs, typename Pred>
+        static constexpr auto
+        any_of_tuple(Xs&&, Pred&&, _integral_constant<int, tuple_detail::ct_false>)
+        { return false_; }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto
+        any_of_tuple(Xs&&, Pred&&, _integral_constant<int, tuple_detail::ct_true>)
+        { return true_; }
 
+        template <typename Xs, typename Pred>
+        static constexpr auto
+        any_of_tuple(Xs&& xs, Pred&& pred,
+                     _integral_constant<int, tuple_detail::runtime>)
+        {
+            return tuple_detail::any_of_runtime::apply(
+                static_cast<Xs&&>(xs), static_cast<Pred&&>(pred));
+        }
+
+        // When the result follows from the compile-time results of the
+        // predicate, it is looked up in the table of these results without
+        // calling the predicate. Otherwise, the predicate is applied at
+        // runtime until an element satisfies it. `all_of` and `none_of`
+        // are defined in terms of `any_of`, and benefit from this too.
         template <typename Xs, typename Pred>
         static constexpr auto apply(Xs&& xs, Pred&& pred) {
-            constexpr detail::std::size_t len = hana::value<
-                decltype(hana::length(xs))
-            >();
-            return any_of_impl::any_of_helper<0, len>::apply(false_,
-                                            static_cast<Xs&&>(xs),
-                                            static_cast<Pred&&>(pred));
+            using Kinds = decltype(
+                tuple_detail::predicate_kinds_until_true_of<Pred&&>(xs)
+            );
+            constexpr int kind = tuple_detail::any_of_kind(Kinds::apply());
+            return any_of_impl::any_of_tuple(static_cast<Xs&&>(xs),
+                                             static_cast<Pred&&>(pred),
+                                             _integral_constant<int, kind>{});
         }
     };
 
@@ -646,14 +1121,17 @@ namespace boost { namespace hana {
             #define BOOST_HANA_PP_TRANSFORM(REF)                                \
                 template <typename ...Xs, typename F>                           \
                 constexpr decltype(auto)                                        \
-                operator()(detail::closure_impl<Xs...> REF xs, F&& f) const     \
-                { return hana::make<Tuple>(f(static_cast<Xs REF>(xs).get)...); }\
+                operator()(detail::closure_impl<Xs...> REF xs, F&& f) const {   \
+                    return hana::make<Tuple>(                                   \
+                        f(detail::get(static_cast<Xs REF>(xs)))...              \
+                    );                                                          \
+                }                                                               \
                                                                                 \
                 template <typename X, typename F>                               \
                 constexpr decltype(auto)                                        \
                 operator()(detail::closure_impl<X> REF xs, F&& f) const {       \
                     return hana::make<Tuple>(static_cast<F&&>(f)(               \
-                        static_cast<X REF>(xs).get                              \
+                        detail::get(static_cast<X REF>(xs))                     \
                     ));                                                         \
                 }                                                               \
             /**/
@@ -791,8 +1269,8 @@ namespace boost { namespace hana {
             > apply(detail::closure_impl<Xs...> REF1 xs,                    \
                     detail::closure_impl<Ys...> REF2 ys)                    \
             {                                                               \
-                return {static_cast<Xs REF1>(xs).get...,                    \
-                        static_cast<Ys REF2>(ys).get...};                   \
+                return {detail::get(static_cast<Xs REF1>(xs))...,           \
+                        detail::get(static_cast<Ys REF2>(ys))...};          \
             }                                                               \
         /**/
         BOOST_HANA_PP_FOR_EACH_REF2(BOOST_HANA_PP_CONCAT)
@@ -851,7 +1329,8 @@ namespace boost { namespace hana {
                 typename detail::std::decay<X>::type, typename Xs::get_type...  \
             > apply(detail::closure_impl<Xs...> REF xs, X&& x) {                \
                 return {                                                        \
-                    static_cast<X&&>(x), static_cast<Xs REF>(xs).get...  \
+                    static_cast<X&&>(x),                                        \
+                    detail::get(static_cast<Xs REF>(xs))...                     \
                 };                                                              \
             }                                                                   \
         /**/
@@ -867,7 +1346,8 @@ namespace boost { namespace hana {
                 typename Xs::get_type..., typename detail::std::decay<X>::type  \
             > apply(detail::closure_impl<Xs...> REF xs, X&& x) {                \
                 return {                                                        \
-                    static_cast<Xs REF>(xs).get..., static_cast<X&&>(x)  \
+                    detail::get(static_cast<Xs REF>(xs))...,                    \
+                    static_cast<X&&>(x)                                         \
                 };                                                              \
             }                                                                   \
         /**/
@@ -966,7 +1446,7 @@ namespace boost { namespace hana {
                 constexpr Size total_length = hana::product<Size>(lengths);         \
                 auto ns = detail::std::make_index_sequence<total_length>{};         \
                 return cartesian_product_helper(ns,                                 \
-                    static_cast<Tuples REF>(xs).get...                              \
+                    detail::get(static_cast<Tuples REF>(xs))...                     \
                 );                                                                  \
             }                                                                       \
                                                                                     \
@@ -978,19 +1458,100 @@ namespace boost { namespace hana {
         #undef BOOST_HANA_PP_CARTESIAN_PRODUCT
     };
 
+    namespace tuple_detail {
+        struct group_end { };
+
+        // Whether two adjacent elements of types `X` and `Y` belong to the
+        // same group. The last element is paired with `group_end`, which
+        // always closes its group.
+        template <typename Pred, typename X, typename Y>
+        struct same_group {
+            static constexpr bool value = hana::value<decltype(
+                detail::std::declval<Pred>()(detail::std::declval<X>(),
+                                             detail::std::declval<Y>())
+            )>();
+        };
+
+        template <typename Pred, typename X>
+        struct same_group<Pred, X, group_end> {
+            static constexpr bool value = false;
+        };
+
+        // Computes the index at which each group of adjacent elements
+        // starts (`which == 0`) or the length of each group (`which == 1`),
+        // given the types `Xs...` of the elements and the types `Ys...`
+        // of their successors.
+        template <int which, typename Pred, typename ...Xs>
+        struct group_helper {
+            template <typename ...Ys>
+            struct with_next {
+                static constexpr auto apply() {
+                    using detail::constexpr_::count;
+                    using detail::constexpr_::array;
+                    using detail::std::size_t;
+
+                    constexpr size_t N = sizeof...(Xs);
+                    constexpr array<bool, N> same = {{
+                        same_group<Pred, Xs, Ys>::value...
+                    }};
+                    constexpr size_t groupsN = count(&same[0], &same[N], false);
+                    array<size_t, groupsN> result{};
+                    size_t* out = &result[0];
+                    size_t start = 0;
+                    for (size_t index = 0; index < N; ++index) {
+                        if (!same[index]) {
+                            *out++ = which == 0 ? start : index + 1 - start;
+                            start = index + 1;
+                        }
+                    }
+                    return result;
+                }
+            };
+        };
+
+        template <int which, typename X1, typename ...Xn, typename Pred>
+        constexpr auto
+        group_indices(detail::closure_impl<X1, Xn...> const&, Pred&&) {
+            using Helper = typename group_helper<
+                which, Pred&&, typename X1::get_type, typename Xn::get_type...
+            >::template with_next<typename Xn::get_type..., group_end>;
+            return tuple_detail::generate_index_sequence<Helper>();
+        }
+
+        template <int which, typename Pred>
+        constexpr auto group_indices(detail::closure_impl<> const&, Pred&&)
+        { return detail::std::index_sequence<>{}; }
+    }
+
     template <>
-    struct init_impl<Tuple> {
-        template <typename Xs, detail::std::size_t ...n>
-        static constexpr decltype(auto)
-        init_helper(Xs&& xs, detail::std::index_sequence<n...>) {
-            return hana::make<Tuple>(
-                        detail::get<n>(static_cast<Xs&&>(xs))...);
+    struct group_pred_impl<Tuple> {
+        template <typename Xs, detail::std::size_t ...start,
+                               detail::std::size_t ...length>
+        static constexpr auto
+        group_helper(Xs&& xs, detail::std::index_sequence<start...>,
+                              detail::std::index_sequence<length...>)
+        {
+            return hana::make_tuple(
+                tuple_detail::get_slice<start>(static_cast<Xs&&>(xs),
+                    detail::std::make_index_sequence<length>{})...
+            );
         }
 
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&& pred) {
+            using tuple_detail::group_indices;
+            auto starts = group_indices<0>(xs, static_cast<Pred&&>(pred));
+            auto lengths = group_indices<1>(xs, static_cast<Pred&&>(pred));
+            return group_helper(static_cast<Xs&&>(xs), starts, lengths);
+        }
+    };
+
+    template <>
+    struct init_impl<Tuple> {
         template <typename Xs>
         static constexpr decltype(auto) apply(Xs&& xs) {
             constexpr detail::std::size_t size = tuple_detail::size<Xs>{}();
-            return init_helper(static_cast<Xs&&>(xs),
+            return tuple_detail::get_subsequence(static_cast<Xs&&>(xs),
                 detail::std::make_index_sequence<size - 1>{});
         }
     };
@@ -1006,13 +1567,16 @@ namespace boost { namespace hana {
         static constexpr Xn const&
         pick(Z const&, detail::element<(i + 1) / 2, Xn> const& x,
             decltype(true_) /* even index */)
-        { return x.get; }
+        { return detail::get(x); }
 
         template <detail::std::size_t i, typename Z, typename Xn>
         static constexpr Xn&&
         pick(Z const&, detail::element<(i + 1) / 2, Xn>&& x,
             decltype(true_) /* even index */)
-        { return static_cast<detail::element<(i + 1) / 2, Xn>&&>(x).get; }
+        {
+            return detail::get(
+                static_cast<detail::element<(i + 1) / 2, Xn>&&>(x));
+        }
 
         template <typename Xs, typename Z, detail::std::size_t ...i>
         static constexpr decltype(auto)
@@ -1084,14 +1648,10 @@ namespace boost { namespace hana {
         remove_at_helper(Xs&& xs, detail::std::index_sequence<before...>,
                                   detail::std::index_sequence<after...>)
         {
-            return hana::make<Tuple>(
-                detail::get<before>(
-                    static_cast<Xs&&>(xs)
-                )...,
-                detail::get<sizeof...(before) + after + 1>(
-                    static_cast<Xs&&>(xs)
-                )...
-            );
+            return tuple_detail::get_subsequence(static_cast<Xs&&>(xs),
+                detail::std::index_sequence<
+                    before..., sizeof...(before) + after + 1 ...
+                >{});
         }
 
         template <typename Xs, typename N>
@@ -1153,39 +1713,152 @@ namespace boost { namespace hana {
 
     template <>
     struct reverse_impl<Tuple> {
-        template <detail::std::size_t ...n, typename ...Xn>
+        template <typename Xs, detail::std::size_t ...n>
         static constexpr decltype(auto)
-        apply(detail::closure_impl<detail::element<n, Xn>...>&& xs) {
-            using Closure = detail::closure_impl<detail::element<n, Xn>...>;
-            return hana::make<Tuple>(detail::get<sizeof...(n) - n - 1>(
-                                            static_cast<Closure&&>(xs))...);
+        reverse_helper(Xs&& xs, detail::std::index_sequence<n...>) {
+            return tuple_detail::get_subsequence(static_cast<Xs&&>(xs),
+                detail::std::index_sequence<sizeof...(n) - n - 1 ...>{});
         }
 
-        template <detail::std::size_t ...n, typename ...Xn>
-        static constexpr decltype(auto)
-        apply(detail::closure_impl<detail::element<n, Xn>...> const& xs) {
-            return hana::make<Tuple>(detail::get<sizeof...(n) - n - 1>(xs)...);
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            constexpr detail::std::size_t size = tuple_detail::size<Xs>{}();
+            return reverse_helper(static_cast<Xs&&>(xs),
+                detail::std::make_index_sequence<size>{});
         }
     };
 
     template <>
-    struct slice_impl<Tuple> {
-        template <detail::std::size_t from, typename Xs, detail::std::size_t ...i>
-        static constexpr decltype(auto)
-        slice_helper(Xs&& xs, detail::std::index_sequence<i...>) {
-            return hana::make<Tuple>(detail::get<from + i>(
-                                        static_cast<Xs&&>(xs))...);
+    struct scan_left_impl<Tuple> {
+        // The results are accumulated as arguments of the recursive calls,
+        // which keeps them alive until they are all moved into the
+        // resulting tuple at once.
+        template <detail::std::size_t i, detail::std::size_t n>
+        struct scan_left_helper {
+            template <typename Xs, typename F, typename State, typename ...Ys>
+            static constexpr auto
+            apply(Xs& xs, F& f, State&& state, Ys&& ...ys) {
+                return scan_left_helper<i + 1, n>::apply(xs, f,
+                    f(state, detail::get<i>(xs)),
+                    static_cast<Ys&&>(ys)..., static_cast<State&&>(state)
+                );
+            }
+        };
+
+        template <detail::std::size_t n>
+        struct scan_left_helper<n, n> {
+            template <typename Xs, typename F, typename State, typename ...Ys>
+            static constexpr auto
+            apply(Xs&, F&, State&& state, Ys&& ...ys) {
+                return hana::make_tuple(static_cast<Ys&&>(ys)...,
+                                        static_cast<State&&>(state));
+            }
+        };
+
+        template <typename Xs, typename State, typename F>
+        static constexpr auto apply(Xs&& xs, State&& state, F&& f) {
+            constexpr detail::std::size_t size = tuple_detail::size<Xs>{}();
+            return scan_left_helper<0, size>::apply(xs, f,
+                                            static_cast<State&&>(state));
+        }
+    };
+
+    template <>
+    struct scan_left_nostate_impl<Tuple> {
+        template <typename Xs, typename F>
+        static constexpr auto apply_helper(Xs& xs, F& f, decltype(false_)) {
+            constexpr detail::std::size_t size = tuple_detail::size<Xs>{}();
+            using Helper = scan_left_impl<Tuple>::scan_left_helper<1, size>;
+            return Helper::apply(xs, f, detail::get<0>(xs));
+        }
+
+        template <typename Xs, typename F>
+        static constexpr auto apply_helper(Xs&, F&, decltype(true_))
+        { return hana::make_tuple(); }
+
+        template <typename Xs, typename F>
+        static constexpr auto apply(Xs&& xs, F&& f) {
+            constexpr detail::std::size_t size = tuple_detail::size<Xs>{}();
+            return apply_helper(xs, f, hana::bool_<size == 0>);
         }
+    };
 
+    template <>
+    struct slice_impl<Tuple> {
         template <typename Xs, typename From, typename To>
         static constexpr decltype(auto) apply(Xs&& xs, From const&, To const&) {
             constexpr detail::std::size_t from = hana::value<From>();
             constexpr detail::std::size_t to = hana::value<To>();
-            return slice_helper<from>(static_cast<Xs&&>(xs),
+            return tuple_detail::get_slice<from>(static_cast<Xs&&>(xs),
                                 detail::std::make_index_sequence<to - from>{});
         }
     };
 
+    template <>
+    struct sort_pred_impl<Tuple> {
+        // The predicate is evaluated once for each pair of elements to
+        // build a comparison matrix, and the sorted permutation is then
+        // computed on indices with `argsort`. This way, no intermediate
+        // tuple is ever created.
+        template <detail::std::size_t N>
+        struct by_matrix {
+            detail::constexpr_::array<detail::constexpr_::array<bool, N>, N> before;
+
+            constexpr bool
+            operator()(detail::std::size_t i, detail::std::size_t j) const
+            { return before[i][j]; }
+        };
+
+        template <typename Pred, typename ...Xs>
+        struct sort_helper {
+            template <typename X>
+            static constexpr
+            detail::constexpr_::array<bool, sizeof...(Xs)> row() {
+                using detail::std::declval;
+                return {{
+                    hana::value<decltype(declval<Pred>()(declval<X>(),
+                                                         declval<Xs>()))>()...
+                }};
+            }
+
+            static constexpr auto apply() {
+                constexpr detail::std::size_t N = sizeof...(Xs);
+                constexpr by_matrix<N> pred{{{row<Xs>()...}}};
+                return detail::constexpr_::array<detail::std::size_t, N>{}
+                        .iota(0).argsort(pred);
+            }
+        };
+
+        template <typename ...Xs, typename Pred>
+        static constexpr auto
+        sort_indices(detail::closure_impl<Xs...> const&, Pred&&) {
+            using tuple_detail::generate_index_sequence;
+            return generate_index_sequence<
+                sort_helper<Pred&&, typename Xs::get_type...>
+            >();
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&& pred) {
+            using tuple_detail::get_subsequence;
+            auto indices = sort_pred_impl::sort_indices(xs, static_cast<Pred&&>(pred));
+            return get_subsequence(static_cast<Xs&&>(xs), indices);
+        }
+    };
+
+    template <>
+    struct argsort_pred_impl<Tuple> {
+        template <detail::std::size_t ...i>
+        static constexpr auto as_tuple_c(detail::std::index_sequence<i...>)
+        { return tuple_c<detail::std::size_t, i...>; }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs const& xs, Pred&& pred) {
+            return as_tuple_c(sort_pred_impl<Tuple>::sort_indices(
+                                        xs, static_cast<Pred&&>(pred)));
+        }
+    };
+
     template <>
     struct sort_impl<Tuple> {
         template <typename T, T ...v, detail::std::size_t ...i>
@@ -1213,30 +1886,94 @@ namespace boost { namespace hana {
         }
     };
 
+    namespace tuple_detail {
+        // Computes the number of leading elements satisfying `Pred`. The
+        // predicate is not applied to the elements following the first
+        // element that does not satisfy it.
+        template <detail::std::size_t n, typename Pred, typename ...Xs>
+        struct while_length
+            : _integral_constant<detail::std::size_t, n>
+        { };
+
+        template <detail::std::size_t n, typename Pred, typename X, typename ...Xs>
+        struct while_length<n, Pred, X, Xs...>
+            : detail::std::conditional_t<
+                hana::value<decltype(
+                    detail::std::declval<Pred>()(detail::std::declval<X>())
+                )>(),
+                while_length<n + 1, Pred, Xs...>,
+                _integral_constant<detail::std::size_t, n>
+            >
+        { };
+
+        template <typename ...Xs, typename Pred>
+        constexpr auto
+        while_length_of(detail::closure_impl<Xs...> const&, Pred&&) {
+            return _integral_constant<detail::std::size_t,
+                while_length<0, Pred&&, typename Xs::get_type...>::value
+            >{};
+        }
+    }
+
     template <>
-    struct take_at_most_impl<Tuple> {
-        template <typename Xs, detail::std::size_t ...n>
-        static constexpr decltype(auto)
-        take_helper(Xs&& xs, detail::std::index_sequence<n...>) {
-            return hana::make<Tuple>(detail::get<n>(static_cast<Xs&&>(xs))...);
+    struct span_impl<Tuple> {
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&& pred) {
+            using tuple_detail::get_slice;
+            constexpr detail::std::size_t size = tuple_detail::size<Xs>{}();
+            constexpr detail::std::size_t n = decltype(
+                tuple_detail::while_length_of(xs, static_cast<Pred&&>(pred))
+            )::value;
+            return hana::make_pair(
+                get_slice<0>(static_cast<Xs&&>(xs),
+                             detail::std::make_index_sequence<n>{}),
+                get_slice<n>(static_cast<Xs&&>(xs),
+                             detail::std::make_index_sequence<size - n>{})
+            );
         }
+    };
 
+    template <>
+    struct take_at_most_impl<Tuple> {
         template <typename Xs, typename N>
         static constexpr decltype(auto) apply(Xs&& xs, N const&) {
             constexpr detail::std::size_t n = hana::value<N>();
             constexpr detail::std::size_t size = tuple_detail::size<Xs>{}();
-            return take_helper(static_cast<Xs&&>(xs),
+            return tuple_detail::get_slice<0>(static_cast<Xs&&>(xs),
                 detail::std::make_index_sequence<(n < size ? n : size)>{});
         }
     };
 
+    template <>
+    struct take_while_impl<Tuple> {
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&& pred) {
+            constexpr detail::std::size_t n = decltype(
+                tuple_detail::while_length_of(xs, static_cast<Pred&&>(pred))
+            )::value;
+            return tuple_detail::get_slice<0>(static_cast<Xs&&>(xs),
+                                    detail::std::make_index_sequence<n>{});
+        }
+    };
+
+    template <>
+    struct unique_pred_impl<Tuple> {
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&& pred) {
+            using tuple_detail::get_subsequence;
+            using tuple_detail::group_indices;
+            auto starts = group_indices<0>(xs, static_cast<Pred&&>(pred));
+            return get_subsequence(static_cast<Xs&&>(xs), starts);
+        }
+    };
+
     template <>
     struct unzip_impl<Tuple> {
         #define BOOST_HANA_PP_UNZIP(REF)                                    \
             template <typename ...Xs>                                       \
             static constexpr decltype(auto)                                 \
             apply(detail::closure_impl<Xs...> REF xs)                       \
-            { return hana::zip(static_cast<Xs REF>(xs).get...); }           \
+            { return hana::zip(detail::get(static_cast<Xs REF>(xs))...); }  \
         /**/
         BOOST_HANA_PP_FOR_EACH_REF1(BOOST_HANA_PP_UNZIP)
         #undef BOOST_HANA_PP_UNZIP
@@ -1248,7 +1985,11 @@ namespace boost { namespace hana {
             template <typename F, typename ...Xs>                           \
             static constexpr decltype(auto) apply(F&& f,                    \
                 detail::closure_impl<Xs...> REF xs)                         \
-            { return hana::make<Tuple>(f(static_cast<Xs REF>(xs).get)...); }\
+            {                                                               \
+                return hana::make<Tuple>(                                   \
+                    f(detail::get(static_cast<Xs REF>(xs)))...              \
+                );                                                          \
+            }                                                               \
         /**/
         BOOST_HANA_PP_FOR_EACH_REF1(BOOST_HANA_PP_ZIP_WITH1)
         #undef BOOST_HANA_PP_ZIP_WITH1
@@ -1260,8 +2001,8 @@ namespace boost { namespace hana {
                 detail::closure_impl<Ys...> REF2 ys)                        \
             {                                                               \
                 return hana::make<Tuple>(                                   \
-                    f(static_cast<Xs REF1>(xs).get,                         \
-                      static_cast<Ys REF2>(ys).get)...                      \
+                    f(detail::get(static_cast<Xs REF1>(xs)),                \
+                      detail::get(static_cast<Ys REF2>(ys)))...             \
                 );                                                          \
             }                                                               \
         /**/
@@ -1276,9 +2017,9 @@ namespace boost { namespace hana {
                 detail::closure_impl<Zs...> REF3 zs)                              \
             {                                                                     \
                 return hana::make<Tuple>(                                         \
-                    f(static_cast<Xs REF1>(xs).get,                               \
-                      static_cast<Ys REF2>(ys).get,                               \
-                      static_cast<Zs REF3>(zs).get)...                            \
+                    f(detail::get(static_cast<Xs REF1>(xs)),                      \
+                      detail::get(static_cast<Ys REF2>(ys)),                      \
+                      detail::get(static_cast<Zs REF3>(zs)))...                   \
                 );                                                                \
             }                                                                     \
         /**/
@@ -1310,7 +2051,7 @@ namespace boost { namespace hana {
             > apply(detail::closure_impl<Xs...> REF xs) {                   \
                 return {                                                    \
                     _tuple<typename Xs::get_type>{                          \
-                        static_cast<Xs REF>(xs).get                         \
+                        detail::get(static_cast<Xs REF>(xs))                \
                     }...                                                    \
                 };                                                          \
             }                                                               \
@@ -1328,8 +2069,8 @@ namespace boost { namespace hana {
                 return {                                                    \
                     _tuple<typename Xs::get_type,                           \
                            typename Ys::get_type>{                          \
-                        static_cast<Xs REF1>(xs).get,                       \
-                        static_cast<Ys REF2>(ys).get                        \
+                        detail::get(static_cast<Xs REF1>(xs)),              \
+                        detail::get(static_cast<Ys REF2>(ys))               \
                     }...                                                    \
                 };                                                          \
             }                                                               \
@@ -1350,9 +2091,9 @@ namespace boost { namespace hana {
                     _tuple<typename Xs::get_type,                       \
                            typename Ys::get_type,                       \
                            typename Zs::get_type>{                      \
-                        static_cast<Xs REF1>(xs).get,                   \
-                        static_cast<Ys REF2>(ys).get,                   \
-                        static_cast<Zs REF3>(zs).get                    \
+                        detail::get(static_cast<Xs REF1>(xs)),          \
+                        detail::get(static_cast<Ys REF2>(ys)),          \
+                        detail::get(static_cast<Zs REF3>(zs))           \
                     }...                                                \
                 };                                                      \
             }                                                           \
@@ -27,7 +27,7 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     //! @cond
     template <typename T>
-    struct _type<T>::_ : _type<T>, operators::adl {
+    struct _type<T>::_ : _type<T>, operators::adl_for<_type<T>> {
         using hana = _;
         using datatype = Type;
 
@@ -0,0 +1,590 @@
+/*!
+@file
+Defines `boost::hana::View`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_VIEW_HPP
+#define BOOST_HANA_VIEW_HPP
+
+#include <boost/hana/fwd/view.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/core/operators.hpp>
+#include <boost/hana/detail/constexpr/algorithm.hpp>
+#include <boost/hana/detail/constexpr/array.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/move.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/searchable.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // _view
+    //////////////////////////////////////////////////////////////////////////
+    // A view is made of an implementation object, which knows how to compute
+    // its `n`th element with `Impl::template get<n>(impl)`, and of the range
+    // `[from, to)` of the elements of that implementation that are part of
+    // the view. Restricting that range is how the tail of a view is taken
+    // without computing anything. The elements may be returned by reference
+    // when the implementation refers to an existing sequence.
+    template <typename Impl, detail::std::size_t From, detail::std::size_t To>
+    struct _view
+        : operators::adl_for<_view<Impl, From, To>>
+        , operators::Iterable_ops<_view<Impl, From, To>>
+    {
+        static_assert(From <= To,
+        "invalid usage of boost::hana::_view<Impl, from, to> with from > to");
+
+        static constexpr detail::std::size_t from = From;
+        static constexpr detail::std::size_t to = To;
+
+        Impl impl;
+
+        explicit constexpr _view(Impl const& i) : impl(i) { }
+        explicit constexpr _view(Impl&& i) : impl(detail::std::move(i)) { }
+    };
+
+    template <typename Impl, detail::std::size_t from, detail::std::size_t to>
+    struct datatype<_view<Impl, from, to>> {
+        using type = View;
+    };
+
+    namespace view_detail {
+        // Sequences are referred to by the views built on top of them when
+        // they are lvalues, and moved into the views otherwise. Hence, a
+        // view created from an lvalue must not outlive that lvalue.
+        template <typename Xs>
+        struct stored {
+            using type = typename detail::std::decay<Xs>::type;
+        };
+
+        template <typename Xs>
+        struct stored<Xs&> {
+            using type = Xs&;
+        };
+
+        template <typename Xs>
+        using stored_t = typename stored<Xs>::type;
+
+        template <detail::std::size_t n, typename V>
+        constexpr decltype(auto) get(V const& view) {
+            using Impl = decltype(view.impl);
+            return Impl::template get<V::from + n>(view.impl);
+        }
+
+        template <detail::std::size_t from, detail::std::size_t to,
+                  typename V>
+        constexpr auto subview(V&& view) {
+            using Impl = typename detail::std::decay<
+                decltype(static_cast<V&&>(view).impl)
+            >::type;
+            return _view<Impl, from, to>{static_cast<V&&>(view).impl};
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Operators
+    //////////////////////////////////////////////////////////////////////////
+    namespace operators {
+        template <>
+        struct of<View>
+            : operators::of<Iterable>
+        { };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<View> {
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        unpack_helper(Xs const& xs, F&& f, detail::std::index_sequence<i...>)
+        { return static_cast<F&&>(f)(view_detail::get<i>(xs)...); }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs const& xs, F&& f) {
+            return unpack_helper(xs, static_cast<F&&>(f),
+                detail::std::make_index_sequence<Xs::to - Xs::from>{});
+        }
+    };
+
+    template <>
+    struct for_each_impl<View> {
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        static constexpr void
+        for_each_helper(Xs const& xs, F&& f, detail::std::index_sequence<i...>) {
+            using Swallow = int[];
+            (void)Swallow{1, ((void)f(view_detail::get<i>(xs)), 1)...};
+        }
+
+        template <typename Xs, typename F>
+        static constexpr void apply(Xs const& xs, F&& f) {
+            for_each_helper(xs, static_cast<F&&>(f),
+                detail::std::make_index_sequence<Xs::to - Xs::from>{});
+        }
+    };
+
+    template <>
+    struct length_impl<View> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const&)
+        { return size_t<Xs::to - Xs::from>; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //////////////////////////////////////////////////////////////////////////
+    namespace view_detail {
+        // Only the elements up to the first one satisfying the predicate
+        // are ever instantiated, and only the matching element is actually
+        // created at runtime.
+        template <detail::std::size_t i, detail::std::size_t n>
+        struct find_if_helper {
+            template <typename Xs, typename Pred>
+            static constexpr auto apply(Xs const& xs, Pred&& pred) {
+                constexpr bool satisfied = hana::value<decltype(
+                    pred(view_detail::get<i>(xs))
+                )>();
+                return find_if_helper::found(bool_<satisfied>, xs,
+                                             static_cast<Pred&&>(pred));
+            }
+
+            template <typename Xs, typename Pred>
+            static constexpr auto found(decltype(true_), Xs const& xs, Pred&&)
+            { return hana::just(view_detail::get<i>(xs)); }
+
+            template <typename Xs, typename Pred>
+            static constexpr auto found(decltype(false_), Xs const& xs, Pred&& pred) {
+                return find_if_helper<i + 1, n>::apply(xs,
+                                                static_cast<Pred&&>(pred));
+            }
+        };
+
+        template <detail::std::size_t n>
+        struct find_if_helper<n, n> {
+            template <typename Xs, typename Pred>
+            static constexpr auto apply(Xs const&, Pred&&)
+            { return nothing; }
+        };
+    }
+
+    template <>
+    struct find_if_impl<View> {
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs const& xs, Pred&& pred) {
+            return view_detail::find_if_helper<0, Xs::to - Xs::from>::apply(
+                xs, static_cast<Pred&&>(pred));
+        }
+    };
+
+    template <>
+    struct any_of_impl<View> {
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs const& xs, Pred&& pred) {
+            return hana::is_just(
+                find_if_impl<View>::apply(xs, static_cast<Pred&&>(pred))
+            );
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Iterable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct head_impl<View> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs const& xs) {
+            static_assert(Xs::from != Xs::to,
+            "hana::head(xs) requires the view xs to be non-empty");
+            return view_detail::get<0>(xs);
+        }
+    };
+
+    template <>
+    struct tail_impl<View> {
+        template <typename Xs>
+        static constexpr auto apply(Xs&& xs) {
+            using V = typename detail::std::decay<Xs>::type;
+            return view_detail::subview<V::from + 1, V::to>(
+                                                    static_cast<Xs&&>(xs));
+        }
+    };
+
+    template <>
+    struct is_empty_impl<View> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const&)
+        { return bool_<Xs::from == Xs::to>; }
+    };
+
+    template <>
+    struct at_impl<View> {
+        template <typename Xs, typename N>
+        static constexpr decltype(auto) apply(Xs const& xs, N const&) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            static_assert(n < Xs::to - Xs::from,
+            "hana::at(xs, n) requires n to be less than the length of the view xs");
+            return view_detail::get<n>(xs);
+        }
+    };
+
+    template <>
+    struct random_access<View>
+        : _integral_constant<bool, true>
+    { };
+
+    template <>
+    struct last_impl<View> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs const& xs) {
+            static_assert(Xs::from != Xs::to,
+            "hana::last(xs) requires the view xs to be non-empty");
+            return view_detail::get<Xs::to - Xs::from - 1>(xs);
+        }
+    };
+
+    template <>
+    struct drop_at_most_impl<View> {
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs&& xs, N const&) {
+            using V = typename detail::std::decay<Xs>::type;
+            constexpr detail::std::size_t n = hana::value<N>();
+            constexpr detail::std::size_t from =
+                V::to - V::from < n ? V::to : V::from + n;
+            return view_detail::subview<from, V::to>(static_cast<Xs&&>(xs));
+        }
+    };
+
+    template <>
+    struct drop_exactly_impl<View> {
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs&& xs, N const&) {
+            using V = typename detail::std::decay<Xs>::type;
+            constexpr detail::std::size_t n = hana::value<N>();
+            return view_detail::subview<V::from + n, V::to>(
+                                                    static_cast<Xs&&>(xs));
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // nth_permutation
+    //////////////////////////////////////////////////////////////////////////
+    namespace view_detail {
+        // Returns the positions of the elements in the `n`th permutation of
+        // `k` elements, in lexicographical order. The digits of the Lehmer
+        // code of `n` in the factorial number system tell which of the
+        // remaining elements comes next.
+        template <detail::std::size_t k>
+        constexpr auto permutation_indices(detail::std::size_t n) {
+            detail::constexpr_::array<detail::std::size_t, k> remaining{};
+            detail::constexpr_::array<detail::std::size_t, k> result{};
+            for (detail::std::size_t i = 0; i < k; ++i)
+                remaining[i] = i;
+
+            detail::std::size_t radix = detail::constexpr_::factorial(k);
+            for (detail::std::size_t i = 0; i < k; ++i) {
+                radix /= k - i;
+                detail::std::size_t digit = n / radix;
+                n %= radix;
+                result[i] = remaining[digit];
+                for (detail::std::size_t j = digit; j + 1 < k - i; ++j)
+                    remaining[j] = remaining[j + 1];
+            }
+            return result;
+        }
+
+        template <detail::std::size_t n, typename Xs, detail::std::size_t ...i>
+        constexpr auto
+        nth_permutation_helper(Xs const& xs, detail::std::index_sequence<i...>) {
+            constexpr auto indices = permutation_indices<sizeof...(i)>(n);
+            (void)indices; // remove GCC warning about `indices` being unused
+            return hana::make<typename datatype<Xs>::type>(
+                hana::at_c<indices[i]>(xs)...
+            );
+        }
+    }
+
+    template <detail::std::size_t n>
+    template <typename Xs>
+    constexpr auto _nth_permutation<n>::operator()(Xs const& xs) const {
+        constexpr detail::std::size_t k = hana::value<decltype(hana::length(xs))>();
+        static_assert(n < detail::constexpr_::factorial(k),
+        "hana::nth_permutation<n>(xs) requires 'n' to be less than the "
+        "number of permutations of 'xs'");
+        return view_detail::nth_permutation_helper<n>(xs,
+                                    detail::std::make_index_sequence<k>{});
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // permutations_view
+    //////////////////////////////////////////////////////////////////////////
+    namespace view_detail {
+        constexpr bool factorial_fits(detail::std::size_t k) {
+            detail::std::size_t result = 1;
+            for (detail::std::size_t i = 2; i <= k; ++i) {
+                if (result > static_cast<detail::std::size_t>(-1) / i)
+                    return false;
+                result *= i;
+            }
+            return true;
+        }
+
+        template <typename Xs>
+        struct permutations {
+            Xs xs;
+
+            template <detail::std::size_t n>
+            static constexpr auto get(permutations const& self)
+            { return hana::nth_permutation<n>(self.xs); }
+        };
+    }
+
+    template <typename Xs>
+    constexpr auto _permutations_view::operator()(Xs&& xs) const {
+        using Impl = view_detail::permutations<view_detail::stored_t<Xs>>;
+        constexpr detail::std::size_t k = hana::value<decltype(hana::length(xs))>();
+        static_assert(view_detail::factorial_fits(k),
+        "hana::permutations_view(xs) requires the number of permutations of "
+        "'xs' to fit in a std::size_t");
+        return _view<Impl, 0, detail::constexpr_::factorial(k)>{
+            Impl{static_cast<Xs&&>(xs)}
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // cartesian_product_view
+    //////////////////////////////////////////////////////////////////////////
+    namespace view_detail {
+        // Returns the digits of `n` in the mixed radix given by the lengths
+        // of the sequences, which are the positions of the elements forming
+        // the `n`th element of the cartesian product.
+        template <detail::std::size_t k>
+        constexpr auto mixed_radix_digits(
+            detail::std::size_t n,
+            detail::constexpr_::array<detail::std::size_t, k> lengths)
+        {
+            detail::constexpr_::array<detail::std::size_t, k> result{};
+            for (detail::std::size_t j = k; j-- > 0;) {
+                result[j] = n % lengths[j];
+                n /= lengths[j];
+            }
+            return result;
+        }
+
+        template <typename Xs>
+        struct cartesian_product {
+            Xs xs;
+
+            template <detail::std::size_t n, detail::std::size_t ...j>
+            static constexpr auto
+            get_helper(Xs const& xs, detail::std::index_sequence<j...>) {
+                constexpr detail::constexpr_::array<detail::std::size_t, sizeof...(j)> lengths = {{
+                    hana::value<decltype(hana::length(hana::at_c<j>(xs)))>()...
+                }};
+                constexpr auto digits = mixed_radix_digits(n, lengths);
+                (void)digits; // remove GCC warning about `digits` being unused
+                return hana::make<typename datatype<Xs>::type>(
+                    hana::at_c<digits[j]>(hana::at_c<j>(xs))...
+                );
+            }
+
+            template <detail::std::size_t n>
+            static constexpr auto get(cartesian_product const& self) {
+                constexpr detail::std::size_t k =
+                    hana::value<decltype(hana::length(self.xs))>();
+                return get_helper<n>(self.xs,
+                                     detail::std::make_index_sequence<k>{});
+            }
+
+            template <detail::std::size_t ...j>
+            static constexpr detail::std::size_t
+            total_length(detail::std::index_sequence<j...>) {
+                constexpr detail::std::size_t lengths[] = {
+                    hana::value<decltype(
+                        hana::length(hana::at_c<j>(detail::std::declval<Xs>()))
+                    )>()..., 1
+                };
+                detail::std::size_t result = sizeof...(j) == 0 ? 0 : 1;
+                for (detail::std::size_t i = 0; i < sizeof...(j); ++i)
+                    result *= lengths[i];
+                return result;
+            }
+        };
+    }
+
+    template <typename Xs>
+    constexpr auto _cartesian_product_view::operator()(Xs&& xs) const {
+        using Impl = view_detail::cartesian_product<
+            view_detail::stored_t<Xs>
+        >;
+        constexpr detail::std::size_t k = hana::value<decltype(hana::length(xs))>();
+        constexpr detail::std::size_t length =
+            Impl::total_length(detail::std::make_index_sequence<k>{});
+        return _view<Impl, 0, length>{Impl{static_cast<Xs&&>(xs)}};
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // transform_view
+    //////////////////////////////////////////////////////////////////////////
+    namespace view_detail {
+        template <typename Xs, typename F>
+        struct transform {
+            Xs xs;
+            F f;
+
+            template <detail::std::size_t n>
+            static constexpr decltype(auto) get(transform const& self)
+            { return self.f(hana::at_c<n>(self.xs)); }
+        };
+    }
+
+    template <typename Xs, typename F>
+    constexpr auto _transform_view::operator()(Xs&& xs, F&& f) const {
+        using Impl = view_detail::transform<
+            view_detail::stored_t<Xs>, typename detail::std::decay<F>::type
+        >;
+        constexpr detail::std::size_t n = hana::value<decltype(hana::length(xs))>();
+        return _view<Impl, 0, n>{
+            Impl{static_cast<Xs&&>(xs), static_cast<F&&>(f)}
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // filter_view
+    //////////////////////////////////////////////////////////////////////////
+    namespace view_detail {
+        // The positions of the elements satisfying the predicate are computed
+        // once, when the view is created. Accessing the `n`th element of the
+        // view is then a single `at_c` on the underlying sequence.
+        template <typename Xs, typename Pred, detail::std::size_t ...i>
+        constexpr auto filter_positions(detail::std::index_sequence<i...>) {
+            using detail::constexpr_::count;
+            using detail::constexpr_::array;
+            using detail::std::size_t;
+            using detail::std::declval;
+
+            constexpr size_t N = sizeof...(i);
+            constexpr array<bool, N> results = {{
+                hana::value<decltype(
+                    declval<Pred>()(hana::at_c<i>(declval<Xs>()))
+                )>()...
+            }};
+            constexpr size_t keptN = count(&results[0], &results[N], true);
+            array<size_t, keptN> kept_indices{};
+            size_t* keep = &kept_indices[0];
+            for (size_t index = 0; index < N; ++index)
+                if (results[index])
+                    *keep++ = index;
+            return kept_indices;
+        }
+
+        template <typename Xs, typename Positions>
+        struct filter {
+            Xs xs;
+
+            template <detail::std::size_t n>
+            static constexpr decltype(auto) get(filter const& self) {
+                constexpr auto positions = Positions::apply();
+                return hana::at_c<positions[n]>(self.xs);
+            }
+        };
+
+        template <typename Xs, typename Pred>
+        struct filter_positions_of {
+            static constexpr auto apply() {
+                constexpr detail::std::size_t n = hana::value<decltype(
+                    hana::length(detail::std::declval<Xs>())
+                )>();
+                return filter_positions<Xs, Pred>(
+                                    detail::std::make_index_sequence<n>{});
+            }
+        };
+    }
+
+    template <typename Xs, typename Pred>
+    constexpr auto _filter_view::operator()(Xs&& xs, Pred&&) const {
+        using Positions = view_detail::filter_positions_of<Xs, Pred&&>;
+        using Impl = view_detail::filter<view_detail::stored_t<Xs>, Positions>;
+        constexpr detail::std::size_t n = Positions::apply().size();
+        return _view<Impl, 0, n>{Impl{static_cast<Xs&&>(xs)}};
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // slice_view
+    //////////////////////////////////////////////////////////////////////////
+    namespace view_detail {
+        template <typename Xs>
+        struct identity {
+            Xs xs;
+
+            template <detail::std::size_t n>
+            static constexpr decltype(auto) get(identity const& self)
+            { return hana::at_c<n>(self.xs); }
+        };
+
+        template <detail::std::size_t from, detail::std::size_t to,
+                  typename Xs, typename Datatype>
+        constexpr auto slice(Xs&& xs, Datatype) {
+            using Impl = identity<stored_t<Xs>>;
+            return _view<Impl, from, to>{Impl{static_cast<Xs&&>(xs)}};
+        }
+
+        // Slicing a view only restricts its range, so slices of slices
+        // never nest.
+        template <detail::std::size_t from, detail::std::size_t to,
+                  typename Xs>
+        constexpr auto slice(Xs&& xs, View) {
+            using V = typename detail::std::decay<Xs>::type;
+            return subview<V::from + from, V::from + to>(static_cast<Xs&&>(xs));
+        }
+    }
+
+    template <typename Xs, typename From, typename To>
+    constexpr auto
+    _slice_view::operator()(Xs&& xs, From const&, To const&) const {
+        constexpr detail::std::size_t from = hana::value<From>();
+        constexpr detail::std::size_t to = hana::value<To>();
+        constexpr detail::std::size_t n = hana::value<decltype(hana::length(xs))>();
+        static_assert(from <= to && to <= n,
+        "hana::slice_view(xs, from, to) requires 'from <= to <= length(xs)'");
+        return view_detail::slice<from, to>(static_cast<Xs&&>(xs),
+                                            typename datatype<Xs>::type{});
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // reverse_view
+    //////////////////////////////////////////////////////////////////////////
+    namespace view_detail {
+        template <typename Xs, detail::std::size_t length>
+        struct reverse {
+            Xs xs;
+
+            template <detail::std::size_t n>
+            static constexpr decltype(auto) get(reverse const& self)
+            { return hana::at_c<length - n - 1>(self.xs); }
+        };
+    }
+
+    template <typename Xs>
+    constexpr auto _reverse_view::operator()(Xs&& xs) const {
+        constexpr detail::std::size_t n = hana::value<decltype(hana::length(xs))>();
+        using Impl = view_detail::reverse<view_detail::stored_t<Xs>, n>;
+        return _view<Impl, 0, n>{Impl{static_cast<Xs&&>(xs)}};
+    }
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_VIEW_HPP
@@ -6,6 +6,8 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/detail/closure.hpp>
 
+#include <boost/hana/assert.hpp>
+
 #include <laws/base.hpp>
 
 #include <type_traits>
@@ -104,4 +106,38 @@ int main() {
             test::Tracked b = detail::get<1>(detail::get<0>(std::move(xs))); (void)b;
         }
     }
+
+    // empty base optimization
+    {
+        struct Final final { };
+
+        static_assert(std::is_empty<detail::closure<>>{}, "");
+        static_assert(std::is_empty<detail::closure<T>>{}, "");
+        static_assert(std::is_empty<detail::closure<T, U, V>>{}, "");
+        static_assert(sizeof(detail::closure<T, int, U>) == sizeof(int), "");
+        static_assert(sizeof(detail::closure<int, T, U, V>) == sizeof(int), "");
+
+        // final classes can't be inherited from, so they are stored as members
+        static_assert(!std::is_empty<detail::closure<Final>>{}, "");
+
+        // nested closures are always stored as members, so that the
+        // elements of the inner closure can't be confused with the
+        // elements of the outer closure
+        {
+            using Inner = detail::closure<T, U>;
+            detail::closure<Inner, V> xs{};
+            (void)static_cast<Inner>(detail::get<0>(xs));
+            (void)static_cast<V>(detail::get<1>(xs));
+            (void)static_cast<T>(detail::get<0>(detail::get<0>(xs)));
+            (void)static_cast<U>(detail::get<1>(detail::get<0>(xs)));
+        }
+
+        // the same empty type may appear several times
+        {
+            detail::closure<T, T, int> xs{T{}, T{}, 3};
+            BOOST_HANA_RUNTIME_CHECK(detail::get<2>(xs) == 3);
+            (void)static_cast<T>(detail::get<0>(xs));
+            (void)static_cast<T>(detail::get<1>(xs));
+        }
+    }
 }
@@ -8,6 +8,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/orderable.hpp>
 
 #include <boost/hana/detail/constexpr/algorithm.hpp>
+#include <boost/hana/detail/constexpr/array.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
 using namespace boost::hana;
 namespace cx = boost::hana::detail::constexpr_;
 
@@ -26,6 +28,7 @@ constexpr int constexpr_context() {
     int* last = array + 6;
 
     cx::reverse(first, last);
+    cx::rotate(first, first + 2, last);
 
     cx::next_permutation(first, last, less);
     cx::next_permutation(first, last);
@@ -39,6 +42,13 @@ constexpr int constexpr_context() {
     cx::sort(first, last, equal);
     cx::sort(first, last);
 
+    detail::std::size_t indices[6] = {};
+    cx::argsort(first, last, indices, less);
+    cx::argsort(first, last, indices);
+
+    cx::lower_bound(first, last, 3, less);
+    cx::upper_bound(first, last, 3, less);
+
     cx::find(first, last, 3);
     cx::find_if(first, last, equal.to(3));
 
@@ -51,4 +61,90 @@ constexpr int constexpr_context() {
 
 constexpr int must_be_constexpr = constexpr_context();
 
+
+// Since `sort`, `inplace_merge` and `argsort` are not suggested
+// implementations from cppreference, we make sure they actually sort.
+constexpr bool sorts() {
+    int array[9] = {5, 3, 8, 1, 9, 2, 7, 4, 6};
+    cx::sort(array, array + 9);
+    for (int i = 0; i < 9; ++i)
+        if (array[i] != i + 1)
+            return false;
+
+    int reversed[5] = {5, 4, 3, 2, 1};
+    cx::sort(reversed, reversed + 5, greater);
+    for (int i = 0; i < 5; ++i)
+        if (reversed[i] != 5 - i)
+            return false;
+
+    cx::sort(array, array);
+    cx::sort(array, array + 1);
+    return array[0] == 1;
+}
+static_assert(sorts(), "");
+
+constexpr bool merges() {
+    int xs[9] = {1, 4, 4, 7, 0, 2, 4, 8, 9};
+    cx::inplace_merge(xs, xs + 4, xs + 9, less);
+    int expected[9] = {0, 1, 2, 4, 4, 4, 7, 8, 9};
+    for (int i = 0; i < 9; ++i)
+        if (xs[i] != expected[i])
+            return false;
+
+    cx::inplace_merge(xs, xs, xs + 9, less);
+    cx::inplace_merge(xs, xs + 9, xs + 9, less);
+    return xs[0] == 0 && xs[8] == 9;
+}
+static_assert(merges(), "");
+
+constexpr bool argsorts() {
+    // equivalent elements must keep their relative order
+    int keys[8] = {3, 1, 2, 1, 3, 0, 2, 1};
+    detail::std::size_t expected[8] = {5, 1, 3, 7, 2, 6, 0, 4};
+    detail::std::size_t indices[8] = {};
+    cx::argsort(keys, keys + 8, indices);
+    for (int i = 0; i < 8; ++i)
+        if (indices[i] != expected[i])
+            return false;
+
+    // the input is left untouched
+    return keys[0] == 3 && keys[7] == 1;
+}
+static_assert(argsorts(), "");
+
+// `sort` is stable, and so is `array::sort`, which uses it.
+struct keyed { int key; int position; };
+
+struct by_key {
+    constexpr bool operator()(keyed x, keyed y) const
+    { return x.key < y.key; }
+};
+
+constexpr bool sort_is_stable() {
+    keyed xs[11] = {
+        {2, 0}, {1, 1}, {2, 2}, {0, 3}, {1, 4}, {2, 5},
+        {0, 6}, {1, 7}, {1, 8}, {0, 9}, {2, 10}
+    };
+    cx::sort(xs, xs + 11, by_key{});
+    int expected[11] = {3, 6, 9, 1, 4, 7, 8, 0, 2, 5, 10};
+    for (int i = 0; i < 11; ++i)
+        if (xs[i].position != expected[i])
+            return false;
+    return true;
+}
+static_assert(sort_is_stable(), "");
+
+constexpr bool array_sort_is_stable() {
+    constexpr cx::array<keyed, 6> xs{{
+        {2, 0}, {1, 1}, {2, 2}, {0, 3}, {1, 4}, {2, 5}
+    }};
+    constexpr auto sorted = xs.sort(by_key{});
+    int expected[6] = {3, 1, 4, 0, 2, 5};
+    for (int i = 0; i < 6; ++i)
+        if (sorted[i].position != expected[i])
+            return false;
+    return true;
+}
+static_assert(array_sort_is_stable(), "");
+
 int main() { }
@@ -45,5 +45,25 @@ static_assert(std::is_same<
     detail::std::integer_sequence<int, 0, 1, 2, 3, 4, 5>
 >::value, "");
 
+static_assert(std::is_same<
+    detail::std::make_integer_sequence<char, 3>,
+    detail::std::integer_sequence<char, 0, 1, 2>
+>::value, "");
+
+static_assert(std::is_same<
+    detail::std::make_index_sequence<0>,
+    detail::std::index_sequence<>
+>::value, "");
+
+static_assert(std::is_same<
+    detail::std::make_index_sequence<4>,
+    detail::std::index_sequence<0, 1, 2, 3>
+>::value, "");
+
+static_assert(std::is_same<
+    detail::std::index_sequence_for<int, char, float>,
+    detail::std::index_sequence<0, 1, 2>
+>::value, "");
+
 
 int main() { }
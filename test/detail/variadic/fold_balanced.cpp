@@ -0,0 +1,79 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/detail/variadic/fold_balanced.hpp>
+
+#include <boost/hana/assert.hpp>
+
+#include <laws/base.hpp>
+using namespace boost::hana;
+
+
+struct undefined { };
+
+template <int i>
+using x = test::ct_eq<i>;
+
+struct move_only_plus {
+    test::move_only operator()(test::move_only&&, test::move_only&&) const
+    { return {}; }
+};
+
+struct int_plus {
+    constexpr int operator()(int a, int b) const { return a + b; }
+};
+
+int main() {
+    using detail::variadic::fold_balanced;
+    test::_injection<0> f{};
+
+    BOOST_HANA_CONSTANT_CHECK(equal(
+        fold_balanced(undefined{}, x<1>{}),
+        x<1>{}
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(equal(
+        fold_balanced(f, x<1>{}, x<2>{}),
+        f(x<1>{}, x<2>{})
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(equal(
+        fold_balanced(f, x<1>{}, x<2>{}, x<3>{}),
+        f(f(x<1>{}, x<2>{}), x<3>{})
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(equal(
+        fold_balanced(f, x<1>{}, x<2>{}, x<3>{}, x<4>{}),
+        f(f(x<1>{}, x<2>{}), f(x<3>{}, x<4>{}))
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(equal(
+        fold_balanced(f, x<1>{}, x<2>{}, x<3>{}, x<4>{}, x<5>{}),
+        f(f(f(x<1>{}, x<2>{}), f(x<3>{}, x<4>{})), x<5>{})
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(equal(
+        fold_balanced(f, x<1>{}, x<2>{}, x<3>{}, x<4>{}, x<5>{}, x<6>{}),
+        f(f(f(x<1>{}, x<2>{}), f(x<3>{}, x<4>{})), f(x<5>{}, x<6>{}))
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(equal(
+        fold_balanced(f, x<1>{}, x<2>{}, x<3>{}, x<4>{}, x<5>{}, x<6>{}, x<7>{}),
+        f(f(f(x<1>{}, x<2>{}), f(x<3>{}, x<4>{})), f(f(x<5>{}, x<6>{}), x<7>{}))
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(equal(
+        fold_balanced(f, x<1>{}, x<2>{}, x<3>{}, x<4>{}, x<5>{}, x<6>{}, x<7>{}, x<8>{}),
+        f(f(f(x<1>{}, x<2>{}), f(x<3>{}, x<4>{})), f(f(x<5>{}, x<6>{}), f(x<7>{}, x<8>{})))
+    ));
+
+    // the objects are forwarded to the function
+    fold_balanced(move_only_plus{}, test::move_only{}, test::move_only{},
+                                    test::move_only{});
+
+    // the result of an associative operation is the same as with foldl1
+    static_assert(fold_balanced(int_plus{}, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10) == 55, "");
+}
@@ -0,0 +1,88 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/lazy.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/set.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+using namespace boost::hana;
+
+
+// This test makes sure that empty objects do not take any space when they
+// are stored inside the data structures built on top of `detail::closure`.
+
+template <int i>
+struct policy { };
+
+struct T; struct U; struct V;
+
+struct function {
+    template <typename ...X>
+    constexpr int operator()(X const& ...) const { return 0; }
+};
+
+int main() {
+    // Tuple
+    {
+        static_assert(std::is_empty<
+            decltype(make<Tuple>(policy<0>{}, policy<1>{}, policy<2>{}))
+        >{}, "");
+
+        static_assert(std::is_empty<
+            decltype(make<Tuple>(int_<0>, int_<1>, int_<2>))
+        >{}, "");
+
+        static_assert(std::is_empty<
+            decltype(make<Tuple>(type<T>, type<U>, type<V>))
+        >{}, "");
+
+        static_assert(sizeof(
+            make<Tuple>(policy<0>{}, 1, policy<1>{}, policy<2>{})
+        ) == sizeof(int), "");
+
+        static_assert(sizeof(
+            make<Tuple>(policy<0>{}, policy<1>{}, 'x', policy<2>{}, 1.0)
+        ) == sizeof(_tuple<char, double>), "");
+    }
+
+    // Pair
+    {
+        static_assert(sizeof(make<Pair>(type<T>, 1)) == sizeof(int), "");
+        static_assert(sizeof(make<Pair>(1, int_<1>)) == sizeof(int), "");
+    }
+
+    // Map
+    {
+        static_assert(sizeof(make<Map>(
+            make<Pair>(type<T>, 1),
+            make<Pair>(type<U>, 2),
+            make<Pair>(type<V>, 3)
+        )) == 3 * sizeof(int), "");
+    }
+
+    // Set
+    {
+        static_assert(sizeof(
+            make<Set>(type<T>, type<U>, type<V>, int_<0>, int_<1>)
+        ) == 1, "");
+    }
+
+    // Lazy
+    {
+        static_assert(std::is_empty<
+            decltype(lazy(function{})(type<T>, type<U>))
+        >{}, "");
+
+        static_assert(sizeof(
+            lazy(function{})(type<T>, 1, type<U>)
+        ) == sizeof(int), "");
+    }
+}
@@ -16,12 +16,27 @@ Distributed under the Boost Software License, Version 1.0.
 #include <laws/searchable.hpp>
 
 #include <array>
+#include <type_traits>
 using namespace boost::hana;
 
 
 template <int ...i>
 constexpr auto array() { return std::array<int, sizeof...(i)>{{i...}}; }
 
+struct append_digit {
+    constexpr int operator()(int state, int x) const
+    { return state * 10 + x; }
+};
+
+struct prepend_digit {
+    constexpr int operator()(int x, int state) const
+    { return state * 10 + x; }
+};
+
+struct twice {
+    constexpr long operator()(int x) const { return 2 * x; }
+};
+
 using test::ct_eq;
 
 int main() {
@@ -51,7 +66,45 @@ int main() {
     //////////////////////////////////////////////////////////////////////////
     // Foldable
     //////////////////////////////////////////////////////////////////////////
-    test::TestFoldable<ext::std::Array>{int_arrays};
+    {
+        // fold and fold.left/right when the accumulator keeps its type
+        {
+            constexpr auto xs = array<1, 2, 3, 4>();
+            BOOST_HANA_CONSTEXPR_CHECK(fold.left(xs, 0, append_digit{}) == 1234);
+            BOOST_HANA_CONSTEXPR_CHECK(fold.right(xs, 0, prepend_digit{}) == 4321);
+            BOOST_HANA_CONSTEXPR_CHECK(fold.left(xs, append_digit{}) == 1234);
+            BOOST_HANA_CONSTEXPR_CHECK(fold.right(xs, prepend_digit{}) == 4321);
+
+            constexpr auto x = array<5>();
+            BOOST_HANA_CONSTEXPR_CHECK(fold.left(x, append_digit{}) == 5);
+            BOOST_HANA_CONSTEXPR_CHECK(fold.right(x, prepend_digit{}) == 5);
+        }
+
+        // fold.left when the accumulator changes type
+        {
+            auto xs = fold.left(array<0, 1, 2>(), make<Tuple>(), append);
+            BOOST_HANA_RUNTIME_CHECK(xs == make<Tuple>(0, 1, 2));
+        }
+
+        // sum and product
+        {
+            constexpr auto xs = array<1, 2, 3, 4>();
+            BOOST_HANA_CONSTEXPR_CHECK(sum<>(xs) == 10);
+            BOOST_HANA_CONSTEXPR_CHECK(product<>(xs) == 24);
+            BOOST_HANA_CONSTANT_CHECK(sum<>(array<>()) == int_<0>);
+            BOOST_HANA_CONSTANT_CHECK(product<>(array<>()) == int_<1>);
+        }
+
+        // for_each
+        {
+            std::array<int, 3> xs{{1, 2, 3}};
+            for_each(xs, [](int& x) { x *= 2; });
+            BOOST_HANA_RUNTIME_CHECK(xs == (std::array<int, 3>{{2, 4, 6}}));
+        }
+
+        // laws
+        test::TestFoldable<ext::std::Array>{int_arrays};
+    }
 
 #elif BOOST_HANA_TEST_PART == 4
     //////////////////////////////////////////////////////////////////////////
@@ -113,5 +166,76 @@ int main() {
 
         test::TestSearchable<ext::std::Array>{eq_arrays, eq_keys};
     }
+
+    // any_of with a predicate returning a runtime Logical
+    {
+        BOOST_HANA_CONSTEXPR_CHECK(any_of(array<0, 1, 2>(), equal.to(2)));
+        BOOST_HANA_CONSTEXPR_CHECK(not_(any_of(array<0, 1, 2>(), equal.to(3))));
+        BOOST_HANA_CONSTANT_CHECK(not_(any_of(array<>(), equal.to(3))));
+
+        int calls = 0;
+        BOOST_HANA_RUNTIME_CHECK(any_of(array<0, 1, 2, 3>(), [&](int x) {
+            ++calls;
+            return x == 1;
+        }));
+        BOOST_HANA_RUNTIME_CHECK(calls == 2);
+    }
+
+#elif BOOST_HANA_TEST_PART == 6
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // transform
+        {
+            constexpr auto xs = transform(array<0, 1, 2>(), twice{});
+            static_assert(std::is_same<
+                decltype(xs), std::array<long, 3> const
+            >{}, "");
+            BOOST_HANA_CONSTEXPR_CHECK(xs[0] == 0);
+            BOOST_HANA_CONSTEXPR_CHECK(xs[1] == 2);
+            BOOST_HANA_CONSTEXPR_CHECK(xs[2] == 4);
+
+            BOOST_HANA_RUNTIME_CHECK(
+                transform(array<>(), twice{}) == (std::array<long, 0>{})
+            );
+        }
+    }
+
+#elif BOOST_HANA_TEST_PART == 7
+    //////////////////////////////////////////////////////////////////////////
+    // Conversion from a Foldable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        constexpr auto xs = to<ext::std::Array>(make<Tuple>(0, 1l, 2));
+        static_assert(std::is_same<
+            decltype(xs), std::array<long, 3> const
+        >{}, "");
+        BOOST_HANA_CONSTEXPR_CHECK(xs[0] == 0);
+        BOOST_HANA_CONSTEXPR_CHECK(xs[1] == 1);
+        BOOST_HANA_CONSTEXPR_CHECK(xs[2] == 2);
+
+        BOOST_HANA_CONSTEXPR_CHECK(equal(
+            to<ext::std::Array>(array<0, 1, 2>()), array<0, 1, 2>()
+        ));
+
+        // An empty std::array keeps the type of its elements. Converting
+        // an empty structure of another data type is tested in
+        // test/fail/ext.std.array.to_empty.cpp.
+        static_assert(std::is_same<
+            decltype(to<ext::std::Array>(std::array<long, 0>{})),
+            std::array<long, 0>
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(to<ext::std::Array>(transform(array<>(), twice{}))),
+            std::array<long, 0>
+        >{}, "");
+
+        constexpr auto ys = to<ext::std::Array>(make<Tuple>('x'));
+        static_assert(std::is_same<
+            decltype(ys), std::array<char, 1> const
+        >{}, "");
+        BOOST_HANA_CONSTEXPR_CHECK(ys[0] == 'x');
+    }
 #endif
 }
@@ -0,0 +1,31 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/ext/std/string_view.hpp>
+
+#include <boost/hana/core/convert.hpp>
+#include <boost/hana/string.hpp>
+
+#include <string_view>
+using namespace boost::hana;
+
+
+int main() {
+    static_assert(is_convertible<String, std::string_view>{}, "");
+    static_assert(!is_embedded<String, std::string_view>{}, "");
+
+    auto str = BOOST_HANA_STRING("abcd");
+    constexpr std::string_view view = to<std::string_view>(str);
+    static_assert(view == "abcd", "");
+    static_assert(view.data() == to<char const*>(str), "");
+
+    constexpr std::string_view empty = to<std::string_view>(BOOST_HANA_STRING(""));
+    static_assert(empty.empty(), "");
+
+    // the characters after a null character are part of the view
+    constexpr std::string_view nulls = to<std::string_view>(string<'a', '\0', 'b'>);
+    static_assert(nulls.size() == 3 && nulls[2] == 'b', "");
+}
@@ -0,0 +1,17 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+// The type of the elements of the std::array can't be deduced from an
+// empty structure.
+// BOOST_HANA_FAIL_TEST_DIAGNOSTIC: can't deduce the type of the elements of the std::array
+int main() {
+    hana::to<hana::ext::std::Array>(hana::make_tuple());
+}
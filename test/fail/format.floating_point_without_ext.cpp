@@ -0,0 +1,17 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/format.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+
+
+// Floating point placeholders require <boost/hana/ext/std/format.hpp>.
+// BOOST_HANA_FAIL_TEST_DIAGNOSTIC: to be included to write floating point placeholders
+int main() {
+    char buffer[16];
+    hana::format(hana::type<double>)(buffer, sizeof(buffer), 1.5);
+}
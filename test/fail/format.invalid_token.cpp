@@ -0,0 +1,18 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/format.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+
+
+// The tokens are validated when the format is created, even if it is
+// never used.
+// BOOST_HANA_FAIL_TEST_DIAGNOSTIC: requires each token to be a String or a Type
+int main() {
+    (void)hana::format(BOOST_HANA_STRING("x="), hana::type<int>, 'y');
+}
@@ -0,0 +1,20 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/view.hpp>
+namespace hana = boost::hana;
+
+
+// `at` on a view must not silently read past the end of the view, even when
+// the underlying sequence has more elements.
+// BOOST_HANA_FAIL_TEST_DIAGNOSTIC: hana::at\(xs, n\) requires n to be less than the length of the view xs
+int main() {
+    (void)sizeof(hana::at_c<2>(
+        hana::slice_view(hana::tuple_c<int, 0, 1, 2>, hana::size_t<0>, hana::size_t<2>)
+    ));
+}
@@ -0,0 +1,20 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/view.hpp>
+namespace hana = boost::hana;
+
+
+// `last` on an empty view must not compute the index `to - from - 1`,
+// which would wrap around.
+// BOOST_HANA_FAIL_TEST_DIAGNOSTIC: hana::last\(xs\) requires the view xs to be non-empty
+int main() {
+    (void)sizeof(hana::last(
+        hana::slice_view(hana::tuple_c<int, 0, 1, 2>, hana::size_t<1>, hana::size_t<1>)
+    ));
+}
@@ -0,0 +1,108 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/format.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/ext/std/format.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/type.hpp>
+
+#include <climits>
+#include <cstring>
+using namespace boost::hana;
+
+
+template <typename Formatter, typename ...Args>
+bool writes(Formatter const& f, char const* expected, Args const& ...args) {
+    char buffer[128];
+    std::size_t n = f(buffer, sizeof(buffer), args...);
+    return n == std::strlen(expected) && std::strcmp(buffer, expected) == 0;
+}
+
+int main() {
+    // literals only
+    {
+        BOOST_HANA_RUNTIME_CHECK(writes(format(), ""));
+        BOOST_HANA_RUNTIME_CHECK(writes(format(BOOST_HANA_STRING("")), ""));
+        BOOST_HANA_RUNTIME_CHECK(writes(format(BOOST_HANA_STRING("abc")), "abc"));
+        BOOST_HANA_RUNTIME_CHECK(writes(
+            format(BOOST_HANA_STRING("ab"), BOOST_HANA_STRING("cd")), "abcd"
+        ));
+    }
+
+    // placeholders of each supported type
+    {
+        BOOST_HANA_RUNTIME_CHECK(writes(format(type<char>), "x", 'x'));
+        BOOST_HANA_RUNTIME_CHECK(writes(format(type<bool>), "1", true));
+        BOOST_HANA_RUNTIME_CHECK(writes(format(type<bool>), "0", false));
+
+        BOOST_HANA_RUNTIME_CHECK(writes(format(type<int>), "0", 0));
+        BOOST_HANA_RUNTIME_CHECK(writes(format(type<int>), "7", 7));
+        BOOST_HANA_RUNTIME_CHECK(writes(format(type<int>), "-305", -305));
+        BOOST_HANA_RUNTIME_CHECK(writes(format(type<int>), "2147483647", INT_MAX));
+        BOOST_HANA_RUNTIME_CHECK(writes(format(type<long long>), "-9223372036854775808", LLONG_MIN));
+        BOOST_HANA_RUNTIME_CHECK(writes(format(type<unsigned long long>), "18446744073709551615", ULLONG_MAX));
+        BOOST_HANA_RUNTIME_CHECK(writes(format(type<signed char>), "-128", static_cast<signed char>(-128)));
+
+        BOOST_HANA_RUNTIME_CHECK(writes(format(type<double>), "2.5", 2.5));
+        BOOST_HANA_RUNTIME_CHECK(writes(format(type<double>), "-1e+20", -1e20));
+        BOOST_HANA_RUNTIME_CHECK(writes(format(type<float>), "0.125", 0.125f));
+        BOOST_HANA_RUNTIME_CHECK(writes(format(type<long double>), "-0.75", -0.75l));
+
+        BOOST_HANA_RUNTIME_CHECK(writes(format(type<char const*>), "", ""));
+        BOOST_HANA_RUNTIME_CHECK(writes(format(type<char const*>), "abc", "abc"));
+    }
+
+    // arguments are converted to the type of their placeholder
+    {
+        BOOST_HANA_RUNTIME_CHECK(writes(format(type<int>), "3", 3.9));
+        BOOST_HANA_RUNTIME_CHECK(writes(format(type<double>), "3", 3));
+        BOOST_HANA_RUNTIME_CHECK(writes(format(type<char>), "A", 65));
+    }
+
+    // literals and placeholders
+    {
+        auto f = format(
+            BOOST_HANA_STRING("x="), type<int>,
+            BOOST_HANA_STRING(", y="), type<double>,
+            BOOST_HANA_STRING(", name="), type<char const*>,
+            BOOST_HANA_STRING(".")
+        );
+        BOOST_HANA_RUNTIME_CHECK(writes(f, "x=1, y=0.5, name=abc.", 1, 0.5, "abc"));
+        BOOST_HANA_RUNTIME_CHECK(writes(f, "x=-1, y=-2, name=.", -1, -2.0, ""));
+
+        BOOST_HANA_RUNTIME_CHECK(writes(
+            format(type<int>, type<int>, BOOST_HANA_STRING("|"), type<char>),
+            "12|c", 1, 2, 'c'
+        ));
+    }
+
+    // the output is truncated to the size of the buffer
+    {
+        auto f = format(BOOST_HANA_STRING("value="), type<int>, BOOST_HANA_STRING("!"));
+        char buffer[8];
+        std::memset(buffer, 'z', sizeof(buffer));
+
+        BOOST_HANA_RUNTIME_CHECK(f(buffer, sizeof(buffer), 12345) == 12);
+        BOOST_HANA_RUNTIME_CHECK(std::strcmp(buffer, "value=1") == 0);
+
+        BOOST_HANA_RUNTIME_CHECK(f(buffer, 1, 12345) == 12);
+        BOOST_HANA_RUNTIME_CHECK(buffer[0] == '\0');
+
+        // nothing is written when the size is 0
+        buffer[0] = 'z';
+        BOOST_HANA_RUNTIME_CHECK(f(buffer, 0, 12345) == 12);
+        BOOST_HANA_RUNTIME_CHECK(buffer[0] == 'z');
+        BOOST_HANA_RUNTIME_CHECK(f(nullptr, 0, 12345) == 12);
+    }
+
+    // format can be used in a constant expression
+    {
+        constexpr auto f = format(string<'a', '='>, type<int>);
+        BOOST_HANA_RUNTIME_CHECK(writes(f, "a=4", 4));
+    }
+}
@@ -251,6 +251,65 @@ namespace boost { namespace hana { namespace test {
                 f(x<1>{}, f(x<2>{}, f(x<3>{}, z)))
             ));
 
+            //////////////////////////////////////////////////////////////////
+            // fold.balanced (with initial state)
+            //////////////////////////////////////////////////////////////////
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold.balanced(list(), z, undefined{}),
+                z
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold.balanced(list(x<1>{}), z, f),
+                f(z, x<1>{})
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold.balanced(list(x<1>{}, x<2>{}), z, f),
+                f(z, f(x<1>{}, x<2>{}))
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold.balanced(list(x<1>{}, x<2>{}, x<3>{}), z, f),
+                f(z, f(f(x<1>{}, x<2>{}), x<3>{}))
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold.balanced(list(x<1>{}, x<2>{}, x<3>{}, x<4>{}), z, f),
+                f(z, f(f(x<1>{}, x<2>{}), f(x<3>{}, x<4>{})))
+            ));
+
+            BOOST_HANA_CONSTEXPR_CHECK(equal(
+                fold.balanced(list(1, '2', 3.3), z, f),
+                f(z, f(f(1, '2'), 3.3))
+            ));
+
+            //////////////////////////////////////////////////////////////////
+            // fold.balanced (without initial state)
+            //////////////////////////////////////////////////////////////////
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold.balanced(list(z), undefined{}),
+                z
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold.balanced(list(z, x<2>{}), f),
+                f(z, x<2>{})
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold.balanced(list(z, x<2>{}, x<3>{}), f),
+                f(f(z, x<2>{}), x<3>{})
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold.balanced(list(z, x<2>{}, x<3>{}, x<4>{}, x<5>{}), f),
+                f(f(f(z, x<2>{}), f(x<3>{}, x<4>{})), x<5>{})
+            ));
+
+            // an associative operation gives the same result as fold.left
+            BOOST_HANA_CONSTEXPR_CHECK(
+                fold.balanced(list(1, 2, 3, 4, 5, 6, 7), hana::plus) ==
+                fold.left(list(1, 2, 3, 4, 5, 6, 7), hana::plus)
+            );
+            BOOST_HANA_CONSTEXPR_CHECK(
+                fold.balanced(list(1, 2, 3, 4, 5, 6, 7), 10, hana::plus) ==
+                fold.left(list(1, 2, 3, 4, 5, 6, 7), 10, hana::plus)
+            );
+
             //////////////////////////////////////////////////////////////////
             // monadic_fold.left (with initial state)
             //////////////////////////////////////////////////////////////////
@@ -63,6 +63,28 @@ namespace boost { namespace hana { namespace test {
                         hana::at(xs, hana::pred(hana::length(xs)))
                     ));
 
+                    // The default implementations of last and find_if give
+                    // the same results, whether they access the elements by
+                    // index or walk the structure with tail.
+                    hana::for_each(make<Tuple>(false_, true_), [=](auto random_access) {
+                        constexpr bool by_index = hana::value<decltype(random_access)>();
+                        using Last = iterable_detail::last_helper<It, by_index>;
+                        using FindIf = iterable_detail::find_if_helper<It, by_index>;
+
+                        BOOST_HANA_CHECK(hana::equal(
+                            Last::apply(xs),
+                            hana::at(xs, hana::pred(hana::length(xs)))
+                        ));
+                        BOOST_HANA_CHECK(hana::equal(
+                            FindIf::apply(xs, hana::always(true_)),
+                            hana::just(hana::head(xs))
+                        ));
+                        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+                            FindIf::apply(xs, hana::always(false_)),
+                            nothing
+                        ));
+                    });
+
                 })(xs));
 
                 // drop(xs, 0) == xs
@@ -374,6 +396,74 @@ namespace boost { namespace hana { namespace test {
                 list(x<4>{}, x<5>{}, x<6>{}, x<7>{})
             ));
 
+            //////////////////////////////////////////////////////////////////
+            // Random access
+            //
+            // The default implementations of last, drop and find_if access
+            // the elements by index when `random_access<S>` is true, and
+            // walk the structure with `tail` otherwise. Only one of them is
+            // used for `S`, so we check both explicitly.
+            //////////////////////////////////////////////////////////////////
+            hana::for_each(make<Tuple>(false_, true_), [=](auto random_access) {
+                constexpr bool by_index = hana::value<decltype(random_access)>();
+                using Last = iterable_detail::last_helper<S, by_index>;
+                using DropAtMost = iterable_detail::drop_at_most_helper<S, by_index>;
+                using DropExactly = iterable_detail::drop_exactly_helper<S, by_index>;
+                using FindIf = iterable_detail::find_if_helper<S, by_index>;
+
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    Last::apply(list(x<0>{})),
+                    x<0>{}
+                ));
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    Last::apply(list(invalid<0>{}, invalid<1>{}, x<2>{})),
+                    x<2>{}
+                ));
+
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    DropAtMost::apply(list(), size_t<1>),
+                    list()
+                ));
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    DropAtMost::apply(list(x<0>{}, x<1>{}, x<2>{}), size_t<0>),
+                    list(x<0>{}, x<1>{}, x<2>{})
+                ));
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    DropAtMost::apply(list(x<0>{}, x<1>{}, x<2>{}), size_t<2>),
+                    list(x<2>{})
+                ));
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    DropAtMost::apply(list(x<0>{}, x<1>{}, x<2>{}), size_t<4>),
+                    list()
+                ));
+
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    DropExactly::apply(list(), size_t<0>),
+                    list()
+                ));
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    DropExactly::apply(list(x<0>{}, x<1>{}, x<2>{}), size_t<1>),
+                    list(x<1>{}, x<2>{})
+                ));
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    DropExactly::apply(list(x<0>{}, x<1>{}, x<2>{}), size_t<3>),
+                    list()
+                ));
+
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    FindIf::apply(list(), equal.to(x<0>{})),
+                    nothing
+                ));
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    FindIf::apply(list(x<0>{}, x<1>{}, x<2>{}), equal.to(x<1>{})),
+                    just(x<1>{})
+                ));
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    FindIf::apply(list(x<0>{}, x<1>{}, x<2>{}), equal.to(x<9>{})),
+                    nothing
+                ));
+            });
+
             //////////////////////////////////////////////////////////////////
             // drop_until
             //////////////////////////////////////////////////////////////////
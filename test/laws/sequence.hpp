@@ -391,6 +391,28 @@ namespace boost { namespace hana { namespace test {
                 list(eq<1>{}, eq<2>{})
             ));
 
+            // The default implementation of slice creates the sequence from
+            // the elements at the right indices when `random_access<S>` is
+            // true, and uses take and drop otherwise. Only one of them is
+            // used for `S`, so we check both explicitly.
+            hana::for_each(make<Tuple>(false_, true_), [=](auto random_access) {
+                constexpr bool by_index = hana::value<decltype(random_access)>();
+                using Slice = sequence_detail::slice_helper<S, by_index>;
+
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    Slice::apply(list(), size_t<0>, size_t<0>),
+                    list()
+                ));
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    Slice::apply(list(undefined{}, eq<1>{}, undefined{}), size_t<1>, size_t<2>),
+                    list(eq<1>{})
+                ));
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    Slice::apply(list(undefined{}, eq<1>{}, eq<2>{}), size_t<1>, size_t<3>),
+                    list(eq<1>{}, eq<2>{})
+                ));
+            });
+
             //////////////////////////////////////////////////////////////////
             // take.at_most
             //////////////////////////////////////////////////////////////////
@@ -1740,6 +1762,55 @@ namespace boost { namespace hana { namespace test {
                 ));
             }
 
+            //////////////////////////////////////////////////////////////////
+            // argsort (without a custom predicate)
+            //////////////////////////////////////////////////////////////////
+            {
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    argsort(list()),
+                    list()
+                ));
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    argsort(list(ord<0>{})),
+                    list(size_t<0>)
+                ));
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    argsort(list(ord<1>{}, ord<0>{})),
+                    list(size_t<1>, size_t<0>)
+                ));
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    argsort(list(ord<1>{}, ord<0>{}, ord<-4>{}, ord<2>{})),
+                    list(size_t<2>, size_t<1>, size_t<0>, size_t<3>)
+                ));
+            }
+
+            //////////////////////////////////////////////////////////////////
+            // argsort (with a custom predicate)
+            //////////////////////////////////////////////////////////////////
+            {
+                auto pred = [](auto x, auto y) {
+                    return less(x.unwrap, y.unwrap);
+                };
+                auto a = [](auto z) { return test::tag(eq<999>{}, z); };
+                auto b = [](auto z) { return test::tag(eq<888>{}, z); };
+
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    argsort(list(a(ord<2>{}), b(ord<1>{})), pred),
+                    list(size_t<1>, size_t<0>)
+                ));
+
+                // check stability
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    argsort(list(a(ord<2>{}), b(ord<1>{}), b(ord<2>{}), a(ord<1>{})), pred),
+                    list(size_t<1>, size_t<3>, size_t<0>, size_t<2>)
+                ));
+
+                BOOST_HANA_CONSTANT_CHECK(equal(
+                    argsort.by(pred, list(b(ord<1>{}), a(ord<1>{}), a(ord<0>{}))),
+                    list(size_t<2>, size_t<0>, size_t<1>)
+                ));
+            }
+
             //////////////////////////////////////////////////////////////////
             // group (without a custom predicate)
             //////////////////////////////////////////////////////////////////
@@ -8,9 +8,12 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/assert.hpp>
 #include <boost/hana/core/operators.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/optional.hpp>
 #include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
 #include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
 
 #include <laws/base.hpp>
 #include <laws/comparable.hpp>
@@ -18,6 +21,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <laws/searchable.hpp>
 #include <test/minimal_product.hpp>
 #include <test/seq.hpp>
+
+#include <utility>
 using namespace boost::hana;
 
 
@@ -32,6 +37,8 @@ auto p() { return test::minimal_product(key<i>(), val<j>()); }
 
 struct undefined { };
 
+struct T; struct U; struct V;
+
 int main() {
     auto list = test::seq; (void)list;
     auto foldable = test::seq; (void)foldable;
@@ -203,6 +210,52 @@ int main() {
         ));
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // insert, erase_key and to<Map> move the values out of rvalues
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // `test::move_only` can't be copied, so these would not compile if
+        // any of the values were copied.
+        using test::move_only;
+
+        // with keys that can be looked up by their type
+        {
+            auto map = insert(make<Map>(make<Pair>(type<T>, move_only{})),
+                              make<Pair>(type<U>, move_only{}));
+            auto same = insert(std::move(map), make<Pair>(type<T>, move_only{}));
+            auto erased = erase_key(std::move(same), type<T>);
+            auto unchanged = erase_key(std::move(erased), type<V>);
+            BOOST_HANA_CONSTANT_CHECK(equal(keys(unchanged), make<Tuple>(type<U>)));
+
+            auto converted = to<Map>(make<Tuple>(
+                make<Pair>(type<T>, move_only{}),
+                make<Pair>(type<U>, move_only{}),
+                make<Pair>(type<T>, move_only{})
+            ));
+            BOOST_HANA_CONSTANT_CHECK(
+                equal(keys(converted), make<Tuple>(type<T>, type<U>))
+            );
+        }
+
+        // with keys that must be compared
+        {
+            auto map = insert(make<Map>(make<Pair>(key<1>(), move_only{})),
+                              make<Pair>(key<2>(), move_only{}));
+            auto same = insert(std::move(map), make<Pair>(key<1>(), move_only{}));
+            auto erased = erase_key(std::move(same), key<1>());
+            BOOST_HANA_CONSTANT_CHECK(equal(keys(erased), make<Tuple>(key<2>())));
+
+            auto converted = to<Map>(make<Tuple>(
+                make<Pair>(key<1>(), move_only{}),
+                make<Pair>(key<2>(), move_only{}),
+                make<Pair>(key<1>(), move_only{})
+            ));
+            BOOST_HANA_CONSTANT_CHECK(
+                equal(keys(converted), make<Tuple>(key<1>(), key<2>()))
+            );
+        }
+    }
+
 #elif BOOST_HANA_TEST_PART == 2
     //////////////////////////////////////////////////////////////////////////
     // Conversions
@@ -426,6 +479,20 @@ int main() {
         check(p<1, 1>(), p<2, 2>(), p<3, 3>(), p<4, 4>());
     }
 
+    // visit_at
+    {
+        auto map = make<Map>(p<1, 1>(), p<2, 2>(), p<3, 3>());
+        int visited = 0;
+        for (unsigned i = 0; i < 3; ++i)
+            visit_at(map, i, [&](auto const&) { ++visited; }, [] { });
+        BOOST_HANA_RUNTIME_CHECK(visited == 3);
+
+        BOOST_HANA_RUNTIME_CHECK(visit_at(map, 3,
+            [](auto const&) { return false; },
+            [] { return true; }
+        ));
+    }
+
 #elif BOOST_HANA_TEST_PART == 6
     // fold.right
     {
@@ -477,5 +544,84 @@ int main() {
 
     // laws
     test::TestFoldable<Map>{eq_maps};
+
+#elif BOOST_HANA_TEST_PART == 8
+    //////////////////////////////////////////////////////////////////////////
+    // Lookup of compile-time keys
+    //////////////////////////////////////////////////////////////////////////
+    // Type keys
+    {
+        auto map = make<Map>(
+            make<Pair>(type<T>, 1),
+            make<Pair>(type<U>, '2'),
+            make<Pair>(type<V>, 3.3)
+        );
+
+        BOOST_HANA_RUNTIME_CHECK(at_key(map, type<T>) == 1);
+        BOOST_HANA_RUNTIME_CHECK(at_key(map, type<U>) == '2');
+        BOOST_HANA_RUNTIME_CHECK(at_key(map, type<V>) == 3.3);
+        BOOST_HANA_RUNTIME_CHECK(map[type<U>] == '2');
+        BOOST_HANA_RUNTIME_CHECK(find(map, type<V>) == just(3.3));
+        BOOST_HANA_CONSTANT_CHECK(find(map, type<void>) == nothing);
+        BOOST_HANA_CONSTANT_CHECK(contains(map, type<T>));
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(map, type<void>)));
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(map, int_<1>)));
+
+        BOOST_HANA_RUNTIME_CHECK(
+            at_key(insert(map, make<Pair>(type<T>, 999)), type<T>) == 1
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            at_key(insert(map, make<Pair>(type<void>, 4)), type<void>) == 4
+        );
+    }
+
+    // IntegralConstant keys
+    {
+        auto map = make<Map>(
+            make<Pair>(int_<1>, 1),
+            make<Pair>(int_<2>, 2),
+            make<Pair>(long_<3>, 3)
+        );
+
+        BOOST_HANA_RUNTIME_CHECK(at_key(map, int_<1>) == 1);
+        BOOST_HANA_RUNTIME_CHECK(at_key(map, int_<2>) == 2);
+        BOOST_HANA_RUNTIME_CHECK(at_key(map, long_<3>) == 3);
+
+        // keys of a different type may still compare equal
+        BOOST_HANA_RUNTIME_CHECK(at_key(map, long_<1>) == 1);
+        BOOST_HANA_RUNTIME_CHECK(at_key(map, int_<3>) == 3);
+        BOOST_HANA_CONSTANT_CHECK(contains(map, llong<2>));
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(map, int_<4>)));
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(map, long_<4>)));
+        BOOST_HANA_CONSTANT_CHECK(find(map, int_<4>) == nothing);
+    }
+
+    // String keys
+    {
+        auto map = make<Map>(
+            make<Pair>(BOOST_HANA_STRING("abc"), 1),
+            make<Pair>(BOOST_HANA_STRING("def"), 2)
+        );
+
+        BOOST_HANA_RUNTIME_CHECK(at_key(map, BOOST_HANA_STRING("abc")) == 1);
+        BOOST_HANA_RUNTIME_CHECK(at_key(map, BOOST_HANA_STRING("def")) == 2);
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(map, BOOST_HANA_STRING("ab"))));
+    }
+
+    // Mixed compile-time and other keys
+    {
+        auto map = make<Map>(
+            make<Pair>(type<T>, 1),
+            p<2, 2>(),
+            make<Pair>(int_<3>, 3)
+        );
+
+        BOOST_HANA_RUNTIME_CHECK(at_key(map, type<T>) == 1);
+        BOOST_HANA_CONSTANT_CHECK(equal(at_key(map, key<2>()), val<2>()));
+        BOOST_HANA_RUNTIME_CHECK(at_key(map, int_<3>) == 3);
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(map, type<U>)));
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(map, key<4>())));
+        BOOST_HANA_CONSTANT_CHECK(find(map, type<U>) == nothing);
+    }
 #endif
 }
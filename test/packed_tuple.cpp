@@ -0,0 +1,232 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/packed_tuple.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/functional/always.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <laws/applicative.hpp>
+#include <laws/base.hpp>
+#include <laws/comparable.hpp>
+#include <laws/foldable.hpp>
+#include <laws/functor.hpp>
+#include <laws/iterable.hpp>
+#include <laws/monad.hpp>
+#include <laws/monad_plus.hpp>
+#include <laws/orderable.hpp>
+#include <laws/searchable.hpp>
+#include <laws/traversable.hpp>
+
+#define BOOST_HANA_TEST_SEQUENCE_KNOWN_PARTS 3
+#if BOOST_HANA_TEST_PART == 6
+#   define BOOST_HANA_TEST_SEQUENCE_PART 1
+#elif BOOST_HANA_TEST_PART == 7
+#   define BOOST_HANA_TEST_SEQUENCE_PART 2
+#elif BOOST_HANA_TEST_PART == 8
+#   define BOOST_HANA_TEST_SEQUENCE_PART 3
+#endif
+#include <laws/sequence.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+using namespace boost::hana;
+
+
+template <int i>
+using eq = test::ct_eq<i>;
+
+using test::ct_ord;
+
+// Returns whether a `_packed_tuple<T...>` has no padding other than the
+// padding required at its end to respect the largest alignment.
+template <typename ...T>
+constexpr bool is_packed() {
+    std::size_t sizes[] = {0, sizeof(T)...};
+    std::size_t alignments[] = {1, alignof(T)...};
+    std::size_t size = 0, alignment = 1;
+    for (std::size_t i = 0; i < sizeof...(T) + 1; ++i) {
+        size += sizes[i];
+        if (alignments[i] > alignment)
+            alignment = alignments[i];
+    }
+    size = (size + alignment - 1) / alignment * alignment;
+    return sizeof(_packed_tuple<T...>) == (size == 0 ? 1 : size) &&
+           sizeof(_packed_tuple<T...>) <= sizeof(_tuple<T...>);
+}
+
+int main() {
+    auto big_eq_tuples = make<Tuple>(
+          make<PackedTuple>()
+        , make<PackedTuple>(eq<0>{})
+        , make<PackedTuple>(eq<0>{}, eq<1>{})
+        , make<PackedTuple>(eq<0>{}, eq<1>{}, eq<2>{})
+        , make<PackedTuple>(eq<0>{}, eq<1>{}, eq<2>{}, eq<3>{}, eq<4>{})
+    );
+    (void)big_eq_tuples;
+
+    auto small_eq_tuples = make<Tuple>(
+          make<PackedTuple>()
+        , make<PackedTuple>(eq<0>{})
+        , make<PackedTuple>(eq<0>{}, eq<1>{})
+        , make<PackedTuple>(eq<0>{}, eq<1>{}, eq<2>{})
+    );
+    (void)small_eq_tuples;
+
+    auto ord_tuples = make<Tuple>(
+          make<PackedTuple>()
+        , make<PackedTuple>(ct_ord<0>{})
+        , make<PackedTuple>(ct_ord<0>{}, ct_ord<1>{})
+        , make<PackedTuple>(ct_ord<0>{}, ct_ord<1>{}, ct_ord<2>{})
+        , make<PackedTuple>(ct_ord<0>{}, ct_ord<1>{}, ct_ord<2>{}, ct_ord<3>{}, ct_ord<4>{})
+    );
+    (void)ord_tuples;
+
+    auto eq_values = make<Tuple>(eq<0>{}, eq<1>{}, eq<2>{});
+    (void)eq_values;
+
+    auto predicates = make<Tuple>(
+        equal.to(eq<0>{}), equal.to(eq<1>{}), equal.to(eq<2>{}),
+        always(false_), always(true_)
+    );
+    (void)predicates;
+
+    auto nested_tuples = make<Tuple>(
+          make<PackedTuple>()
+        , make<PackedTuple>(
+            make<PackedTuple>(eq<0>{}))
+        , make<PackedTuple>(
+            make<PackedTuple>(eq<0>{}),
+            make<PackedTuple>(eq<1>{}, eq<2>{}))
+        , make<PackedTuple>(
+            make<PackedTuple>(eq<0>{}),
+            make<PackedTuple>(eq<1>{}, eq<2>{}),
+            make<PackedTuple>(eq<3>{}, eq<4>{}))
+    );
+    (void)nested_tuples;
+
+#if BOOST_HANA_TEST_PART == 1
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto eq_tuple_keys = make<Tuple>(eq<3>{}, eq<5>{}, eq<7>{});
+        test::TestSearchable<PackedTuple>{small_eq_tuples, eq_tuple_keys};
+
+        auto bools = make<Tuple>(
+              make<PackedTuple>(true_)
+            , make<PackedTuple>(false_)
+            , make<PackedTuple>(true_, true_)
+            , make<PackedTuple>(true_, false_)
+            , make<PackedTuple>(false_, true_)
+            , make<PackedTuple>(false_, false_)
+        );
+        test::TestSearchable<PackedTuple>{bools, make<Tuple>(true_, false_)};
+    }
+
+#elif BOOST_HANA_TEST_PART == 2
+    //////////////////////////////////////////////////////////////////////////
+    // Comparable and Orderable
+    //////////////////////////////////////////////////////////////////////////
+    test::TestComparable<PackedTuple>{big_eq_tuples};
+    test::TestOrderable<PackedTuple>{ord_tuples};
+
+#elif BOOST_HANA_TEST_PART == 3
+    //////////////////////////////////////////////////////////////////////////
+    // MonadPlus
+    //////////////////////////////////////////////////////////////////////////
+    test::TestMonadPlus<PackedTuple>{small_eq_tuples, predicates, eq_values};
+
+#elif BOOST_HANA_TEST_PART == 4
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable, Iterable, Traversable
+    //////////////////////////////////////////////////////////////////////////
+    test::TestFoldable<PackedTuple>{big_eq_tuples};
+    test::TestIterable<PackedTuple>{big_eq_tuples};
+    test::TestTraversable<PackedTuple>{};
+
+#elif BOOST_HANA_TEST_PART == 5
+    //////////////////////////////////////////////////////////////////////////
+    // Functor up to Monad
+    //////////////////////////////////////////////////////////////////////////
+    {
+        test::TestFunctor<PackedTuple>{big_eq_tuples, eq_values};
+        test::TestApplicative<PackedTuple>{small_eq_tuples};
+        test::TestMonad<PackedTuple>{big_eq_tuples, nested_tuples};
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Sequence
+    //////////////////////////////////////////////////////////////////////////
+#elif BOOST_HANA_TEST_PART == 6 || BOOST_HANA_TEST_PART == 7 || BOOST_HANA_TEST_PART == 8
+    test::TestSequence<PackedTuple>{};
+
+#elif BOOST_HANA_TEST_PART == 9
+    //////////////////////////////////////////////////////////////////////////
+    // Layout
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // sizeof matrix
+        {
+            BOOST_HANA_CONSTEXPR_CHECK(is_packed<>());
+            BOOST_HANA_CONSTEXPR_CHECK(is_packed<char>());
+            BOOST_HANA_CONSTEXPR_CHECK(is_packed<double>());
+            BOOST_HANA_CONSTEXPR_CHECK(is_packed<char, double>());
+            BOOST_HANA_CONSTEXPR_CHECK(is_packed<double, char>());
+            BOOST_HANA_CONSTEXPR_CHECK(is_packed<char, double, char, int>());
+            BOOST_HANA_CONSTEXPR_CHECK(is_packed<char, short, char, int, char>());
+            BOOST_HANA_CONSTEXPR_CHECK(is_packed<bool, long long, short, float, char>());
+            BOOST_HANA_CONSTEXPR_CHECK(is_packed<char, int*, short, double, char, int>());
+            BOOST_HANA_CONSTEXPR_CHECK(is_packed<char[3], double, char, short[2]>());
+            BOOST_HANA_CONSTEXPR_CHECK(is_packed<eq<0>, int, char, eq<1>>());
+        }
+
+        // packed tuples of trivial elements are trivially copyable
+        {
+            using Record = _packed_tuple<char, double, char, int>;
+            static_assert(std::is_trivially_copyable<Record>{}, "");
+            static_assert(std::is_trivially_destructible<Record>{}, "");
+            static_assert(std::is_trivially_copy_assignable<Record>{}, "");
+            static_assert(std::is_trivially_move_assignable<Record>{}, "");
+
+            Record xs{'a', 1.5, 'b', 2};
+            Record ys{};
+            ys = xs;
+            BOOST_HANA_RUNTIME_CHECK(ys == make<PackedTuple>('a', 1.5, 'b', 2));
+        }
+
+        // the logical order of the elements is preserved
+        {
+            constexpr auto xs = make<PackedTuple>('a', 1.5, short{2}, 3);
+            BOOST_HANA_CONSTEXPR_CHECK(at_c<0>(xs) == 'a');
+            BOOST_HANA_CONSTEXPR_CHECK(at_c<1>(xs) == 1.5);
+            BOOST_HANA_CONSTEXPR_CHECK(at_c<2>(xs) == 2);
+            BOOST_HANA_CONSTEXPR_CHECK(at_c<3>(xs) == 3);
+
+            BOOST_HANA_RUNTIME_CHECK(
+                unpack(xs, make<Tuple>) == make<Tuple>('a', 1.5, short{2}, 3)
+            );
+            BOOST_HANA_RUNTIME_CHECK(
+                to<Tuple>(xs) == make<Tuple>('a', 1.5, short{2}, 3)
+            );
+            BOOST_HANA_RUNTIME_CHECK(
+                reverse(xs) == make<PackedTuple>(3, short{2}, 1.5, 'a')
+            );
+        }
+
+        // elements can be modified in place
+        {
+            auto xs = make<PackedTuple>('a', 1.5, 3);
+            at_c<1>(xs) = 2.5;
+            for_each(xs, [](auto& x) { x += 1; });
+            BOOST_HANA_RUNTIME_CHECK(xs == make<PackedTuple>('b', 3.5, 4));
+        }
+    }
+#endif
+}
@@ -8,20 +8,43 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/assert.hpp>
 #include <boost/hana/core/operators.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/optional.hpp>
+#include <boost/hana/string.hpp>
 #include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
 
 #include <laws/base.hpp>
 #include <laws/comparable.hpp>
 #include <laws/foldable.hpp>
 #include <laws/searchable.hpp>
 #include <test/seq.hpp>
+
+#include <utility>
 using namespace boost::hana;
 
 
 using test::ct_eq;
 struct undefined { };
 
+struct T; struct U; struct V;
+
+// Move-only keys, whose comparison is known at compile-time.
+template <int i>
+struct move_only_key {
+    move_only_key() = default;
+    move_only_key(move_only_key const&) = delete;
+    move_only_key(move_only_key&&) = default;
+};
+
+template <int i, int j>
+constexpr auto operator==(move_only_key<i> const&, move_only_key<j> const&)
+{ return bool_<i == j>; }
+
+template <int i, int j>
+constexpr auto operator!=(move_only_key<i> const&, move_only_key<j> const&)
+{ return bool_<i != j>; }
+
 int main() {
     auto eqs = make<Tuple>(
         make<Set>(),
@@ -216,6 +239,26 @@ int main() {
         }
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // insert, erase_key and to<Set> move the elements out of rvalues
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // `move_only_key` can't be copied, so these would not compile if
+        // any of the elements were copied.
+        auto set = insert(make<Set>(move_only_key<1>{}), move_only_key<2>{});
+        auto same = insert(std::move(set), move_only_key<1>{});
+        auto erased = erase_key(std::move(same), move_only_key<1>{});
+        auto unchanged = erase_key(std::move(erased), move_only_key<3>{});
+        BOOST_HANA_CONSTANT_CHECK(equal(unchanged, make<Set>(move_only_key<2>{})));
+
+        auto converted = to<Set>(make<Tuple>(
+            move_only_key<1>{}, move_only_key<2>{}, move_only_key<1>{}
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            converted, make<Set>(move_only_key<1>{}, move_only_key<2>{})
+        ));
+    }
+
 #elif BOOST_HANA_TEST_PART == 2
     //////////////////////////////////////////////////////////////////////////
     // Comparable
@@ -334,5 +377,63 @@ int main() {
         // laws
         test::TestFoldable<Set>{eqs};
     }
+
+#elif BOOST_HANA_TEST_PART == 5
+    //////////////////////////////////////////////////////////////////////////
+    // Compile-time elements
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // to<Set>
+        {
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                to<Set>(make<Tuple>(type<T>, type<U>, type<T>, type<V>, type<U>)),
+                set(type<T>, type<U>, type<V>)
+            ));
+
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                to<Set>(make<Tuple>(int_<1>, int_<2>, int_<1>, int_<1>)),
+                set(int_<1>, int_<2>)
+            ));
+
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                to<Set>(make<Tuple>(BOOST_HANA_STRING("abc"), type<T>,
+                                    BOOST_HANA_STRING("abc"), int_<1>)),
+                set(BOOST_HANA_STRING("abc"), type<T>, int_<1>)
+            ));
+
+            // IntegralConstants of different types may be equal
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                to<Set>(make<Tuple>(int_<1>, long_<1>, int_<2>)),
+                set(int_<1>, int_<2>)
+            ));
+
+            // elements without a compile-time index
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                to<Set>(make<Tuple>(type<T>, ct_eq<1>{}, type<T>, ct_eq<1>{})),
+                set(type<T>, ct_eq<1>{})
+            ));
+        }
+
+        // contains and find
+        {
+            auto xs = set(type<T>, int_<1>, BOOST_HANA_STRING("abc"));
+
+            BOOST_HANA_CONSTANT_CHECK(contains(xs, type<T>));
+            BOOST_HANA_CONSTANT_CHECK(contains(xs, int_<1>));
+            BOOST_HANA_CONSTANT_CHECK(contains(xs, long_<1>));
+            BOOST_HANA_CONSTANT_CHECK(contains(xs, BOOST_HANA_STRING("abc")));
+            BOOST_HANA_CONSTANT_CHECK(not_(contains(xs, type<U>)));
+            BOOST_HANA_CONSTANT_CHECK(not_(contains(xs, int_<2>)));
+            BOOST_HANA_CONSTANT_CHECK(not_(contains(xs, ct_eq<5>{})));
+
+            BOOST_HANA_CONSTANT_CHECK(equal(find(xs, type<T>), just(type<T>)));
+            BOOST_HANA_CONSTANT_CHECK(equal(find(xs, type<U>), nothing));
+
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                insert(insert(xs, type<U>), type<T>),
+                set(type<T>, type<U>, int_<1>, BOOST_HANA_STRING("abc"))
+            ));
+        }
+    }
 #endif
 }
@@ -12,7 +12,9 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/operators.hpp>
 #include <boost/hana/functional/always.hpp>
 #include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
 #include <boost/hana/optional.hpp>
+#include <boost/hana/pair.hpp>
 #include <boost/hana/tuple.hpp>
 
 #include <laws/base.hpp>
@@ -23,6 +25,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <laws/searchable.hpp>
 
 #include <cstring>
+#include <string>
 #include <type_traits>
 using namespace boost::hana;
 
@@ -455,5 +458,287 @@ int main() {
         );
         test::TestSearchable<String>{strings, keys};
     }
+
+#elif BOOST_HANA_TEST_PART == 6
+    //////////////////////////////////////////////////////////////////////////
+    // Substring algorithms
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // find_substring
+        {
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find_substring(BOOST_HANA_STRING(""), BOOST_HANA_STRING("")),
+                just(boost::hana::size_t<0>)
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find_substring(BOOST_HANA_STRING(""), BOOST_HANA_STRING("a")),
+                nothing
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find_substring(BOOST_HANA_STRING("abcd"), BOOST_HANA_STRING("")),
+                just(boost::hana::size_t<0>)
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find_substring(BOOST_HANA_STRING("abcd"), BOOST_HANA_STRING("a")),
+                just(boost::hana::size_t<0>)
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find_substring(BOOST_HANA_STRING("abcbcd"), BOOST_HANA_STRING("bc")),
+                just(boost::hana::size_t<1>)
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find_substring(BOOST_HANA_STRING("abcd"), BOOST_HANA_STRING("cd")),
+                just(boost::hana::size_t<2>)
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find_substring(BOOST_HANA_STRING("abcd"), BOOST_HANA_STRING("ac")),
+                nothing
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find_substring(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("abcd")),
+                nothing
+            ));
+        }
+
+        // starts_with
+        {
+            BOOST_HANA_CONSTANT_CHECK(
+                starts_with(BOOST_HANA_STRING(""), BOOST_HANA_STRING(""))
+            );
+            BOOST_HANA_CONSTANT_CHECK(
+                starts_with(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING(""))
+            );
+            BOOST_HANA_CONSTANT_CHECK(
+                starts_with(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("ab"))
+            );
+            BOOST_HANA_CONSTANT_CHECK(
+                starts_with(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("abc"))
+            );
+            BOOST_HANA_CONSTANT_CHECK(not_(
+                starts_with(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("bc"))
+            ));
+            BOOST_HANA_CONSTANT_CHECK(not_(
+                starts_with(BOOST_HANA_STRING("ab"), BOOST_HANA_STRING("abc"))
+            ));
+        }
+
+        // ends_with
+        {
+            BOOST_HANA_CONSTANT_CHECK(
+                ends_with(BOOST_HANA_STRING(""), BOOST_HANA_STRING(""))
+            );
+            BOOST_HANA_CONSTANT_CHECK(
+                ends_with(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING(""))
+            );
+            BOOST_HANA_CONSTANT_CHECK(
+                ends_with(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("bc"))
+            );
+            BOOST_HANA_CONSTANT_CHECK(
+                ends_with(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("abc"))
+            );
+            BOOST_HANA_CONSTANT_CHECK(not_(
+                ends_with(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("ab"))
+            ));
+            BOOST_HANA_CONSTANT_CHECK(not_(
+                ends_with(BOOST_HANA_STRING("bc"), BOOST_HANA_STRING("abc"))
+            ));
+        }
+
+        // split
+        {
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                split(BOOST_HANA_STRING(""), BOOST_HANA_STRING(".")),
+                make<Tuple>(BOOST_HANA_STRING(""))
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                split(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING(".")),
+                make<Tuple>(BOOST_HANA_STRING("abc"))
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                split(BOOST_HANA_STRING("a.bc.d"), BOOST_HANA_STRING(".")),
+                make<Tuple>(BOOST_HANA_STRING("a"), BOOST_HANA_STRING("bc"),
+                            BOOST_HANA_STRING("d"))
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                split(BOOST_HANA_STRING(".a..b."), BOOST_HANA_STRING(".")),
+                make<Tuple>(BOOST_HANA_STRING(""), BOOST_HANA_STRING("a"),
+                            BOOST_HANA_STRING(""), BOOST_HANA_STRING("b"),
+                            BOOST_HANA_STRING(""))
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                split(BOOST_HANA_STRING("a::b:::c"), BOOST_HANA_STRING("::")),
+                make<Tuple>(BOOST_HANA_STRING("a"), BOOST_HANA_STRING("b"),
+                            BOOST_HANA_STRING(":c"))
+            ));
+        }
+
+        // replace_substring
+        {
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                replace_substring(BOOST_HANA_STRING(""), BOOST_HANA_STRING("a"),
+                                  BOOST_HANA_STRING("b")),
+                BOOST_HANA_STRING("")
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                replace_substring(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("d"),
+                                  BOOST_HANA_STRING("e")),
+                BOOST_HANA_STRING("abc")
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                replace_substring(BOOST_HANA_STRING("a.b.c"), BOOST_HANA_STRING("."),
+                                  BOOST_HANA_STRING("::")),
+                BOOST_HANA_STRING("a::b::c")
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                replace_substring(BOOST_HANA_STRING("a::b::c"), BOOST_HANA_STRING("::"),
+                                  BOOST_HANA_STRING("")),
+                BOOST_HANA_STRING("abc")
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                replace_substring(BOOST_HANA_STRING("aaaaa"), BOOST_HANA_STRING("aa"),
+                                  BOOST_HANA_STRING("b")),
+                BOOST_HANA_STRING("bba")
+            ));
+        }
+
+        // string_concat
+        {
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                string_concat(),
+                BOOST_HANA_STRING("")
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                string_concat(BOOST_HANA_STRING("")),
+                BOOST_HANA_STRING("")
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                string_concat(BOOST_HANA_STRING("abc")),
+                BOOST_HANA_STRING("abc")
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                string_concat(BOOST_HANA_STRING("ab"), BOOST_HANA_STRING("")),
+                BOOST_HANA_STRING("ab")
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                string_concat(BOOST_HANA_STRING("ab"), BOOST_HANA_STRING("c"),
+                              BOOST_HANA_STRING(""), BOOST_HANA_STRING("de")),
+                BOOST_HANA_STRING("abcde")
+            ));
+        }
+
+        // string_join
+        {
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                string_join(make<Tuple>(), BOOST_HANA_STRING(", ")),
+                BOOST_HANA_STRING("")
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                string_join(make<Tuple>(BOOST_HANA_STRING("a")), BOOST_HANA_STRING(", ")),
+                BOOST_HANA_STRING("a")
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                string_join(make<Tuple>(BOOST_HANA_STRING("a"), BOOST_HANA_STRING(""),
+                                 BOOST_HANA_STRING("bc")),
+                     BOOST_HANA_STRING(", ")),
+                BOOST_HANA_STRING("a, , bc")
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                string_join(make<Tuple>(BOOST_HANA_STRING("a"), BOOST_HANA_STRING("b")),
+                     BOOST_HANA_STRING("")),
+                BOOST_HANA_STRING("ab")
+            ));
+
+            // string_join is the inverse of split
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                string_join(split(BOOST_HANA_STRING(".a..b."), BOOST_HANA_STRING(".")),
+                     BOOST_HANA_STRING(".")),
+                BOOST_HANA_STRING(".a..b.")
+            ));
+        }
+    }
+
+#elif BOOST_HANA_TEST_PART == 7
+    //////////////////////////////////////////////////////////////////////////
+    // string_switch
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto id = [](int i) { return i; };
+        auto fallback = [] { return -1; };
+
+        {
+            auto sw = string_switch(make<Map>());
+            BOOST_HANA_RUNTIME_CHECK(sw("", 0, id, fallback) == -1);
+            BOOST_HANA_RUNTIME_CHECK(sw("abc", 3, id, fallback) == -1);
+        }
+
+        {
+            auto sw = string_switch(make<Map>(
+                make<Pair>(BOOST_HANA_STRING(""), 0),
+                make<Pair>(BOOST_HANA_STRING("a"), 1),
+                make<Pair>(BOOST_HANA_STRING("ab"), 2),
+                make<Pair>(BOOST_HANA_STRING("abc"), 3),
+                make<Pair>(BOOST_HANA_STRING("ba"), 4),
+                make<Pair>(BOOST_HANA_STRING("abd"), 5)
+            ));
+
+            BOOST_HANA_RUNTIME_CHECK(sw("", 0, id, fallback) == 0);
+            BOOST_HANA_RUNTIME_CHECK(sw(nullptr, 0, id, fallback) == 0);
+            BOOST_HANA_RUNTIME_CHECK(sw("a", 1, id, fallback) == 1);
+            BOOST_HANA_RUNTIME_CHECK(sw("ab", 2, id, fallback) == 2);
+            BOOST_HANA_RUNTIME_CHECK(sw("abc", 3, id, fallback) == 3);
+            BOOST_HANA_RUNTIME_CHECK(sw("ba", 2, id, fallback) == 4);
+            BOOST_HANA_RUNTIME_CHECK(sw("abd", 3, id, fallback) == 5);
+
+            // only the given number of characters is considered
+            BOOST_HANA_RUNTIME_CHECK(sw("abcd", 2, id, fallback) == 2);
+            BOOST_HANA_RUNTIME_CHECK(sw("abcd", 4, id, fallback) == -1);
+            BOOST_HANA_RUNTIME_CHECK(sw("b", 1, id, fallback) == -1);
+            BOOST_HANA_RUNTIME_CHECK(sw("abe", 3, id, fallback) == -1);
+
+            // objects with data() and size()
+            BOOST_HANA_RUNTIME_CHECK(sw(std::string{"ba"}, id, fallback) == 4);
+            BOOST_HANA_RUNTIME_CHECK(sw(std::string{"bab"}, id, fallback) == -1);
+        }
+
+        // the handlers may return different types
+        {
+            auto sw = string_switch(make<Map>(
+                make<Pair>(BOOST_HANA_STRING("int"), 1),
+                make<Pair>(BOOST_HANA_STRING("double"), 2.5),
+                make<Pair>(BOOST_HANA_STRING("string"), std::string{"xyz"})
+            ));
+            struct {
+                double operator()(int i) const { return i; }
+                double operator()(double d) const { return d; }
+                double operator()(std::string const& s) const { return s.size(); }
+            } size;
+
+            BOOST_HANA_RUNTIME_CHECK(sw("int", 3, size, [] { return 0.0; }) == 1);
+            BOOST_HANA_RUNTIME_CHECK(sw("double", 6, size, [] { return 0.0; }) == 2.5);
+            BOOST_HANA_RUNTIME_CHECK(sw("string", 6, size, [] { return 0.0; }) == 3);
+            BOOST_HANA_RUNTIME_CHECK(sw("float", 5, size, [] { return 0.0; }) == 0);
+        }
+
+        // the values are passed to the function by reference, so they
+        // need not be copyable
+        {
+            struct handler {
+                int value;
+                handler(int v) : value{v} { }
+                handler(handler const&) = delete;
+                handler(handler&&) = default;
+            };
+
+            auto sw = string_switch(make<Map>(
+                make<Pair>(BOOST_HANA_STRING("a"), handler{1}),
+                make<Pair>(BOOST_HANA_STRING("b"), handler{2})
+            ));
+            auto call = [](handler const& h) { return h.value; };
+
+            BOOST_HANA_RUNTIME_CHECK(sw("a", 1, call, fallback) == 1);
+            BOOST_HANA_RUNTIME_CHECK(sw("b", 1, call, fallback) == 2);
+            BOOST_HANA_RUNTIME_CHECK(sw("c", 1, call, fallback) == -1);
+        }
+    }
 #endif
 }
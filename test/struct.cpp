@@ -276,6 +276,39 @@ int main() {
             ));
         }
 
+        // visit_at
+        {
+            auto is = [](auto expected) {
+                return [=](auto const& member) {
+                    return if_(equal(member, expected), true, false);
+                };
+            };
+            auto out_of_bounds = [] { return false; };
+            auto strct = obj(ct_eq<0>{}, ct_eq<1>{});
+
+            BOOST_HANA_RUNTIME_CHECK(visit_at(strct, 0,
+                is(prod(int_<0>, ct_eq<0>{})), out_of_bounds));
+            BOOST_HANA_RUNTIME_CHECK(visit_at(strct, 1,
+                is(prod(int_<1>, ct_eq<1>{})), out_of_bounds));
+            BOOST_HANA_RUNTIME_CHECK(!visit_at(strct, 1,
+                is(prod(int_<0>, ct_eq<0>{})), out_of_bounds));
+            BOOST_HANA_RUNTIME_CHECK(!visit_at(strct, 2,
+                is(prod(int_<0>, ct_eq<0>{})), [] { return false; }));
+            BOOST_HANA_RUNTIME_CHECK(visit_at(obj(), 0,
+                is(prod(int_<0>, ct_eq<0>{})), [] { return true; }));
+
+            // the visited member is passed by reference, not copied
+            auto address = [](auto const& member) -> void const* {
+                return &second(member);
+            };
+            auto no_address = []() -> void const* { return nullptr; };
+            auto members = obj(1, move_only{});
+            BOOST_HANA_RUNTIME_CHECK(visit_at(members, 0, address, no_address)
+                == &at_c<0>(members.members));
+            BOOST_HANA_RUNTIME_CHECK(visit_at(members, 1, address, no_address)
+                == &at_c<1>(members.members));
+        }
+
         // laws
         test::TestFoldable<MinimalStruct<0>>{eq0};
         test::TestFoldable<MinimalStruct<1>>{eq1};
@@ -0,0 +1,126 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <vector>
+namespace hana = boost::hana;
+
+
+// This test is also built with fold-expressions enabled, in which case we
+// make sure that the corresponding implementation is actually used.
+#if defined(BOOST_HANA_TEST_CXX1Z_FOLD_EXPRESSIONS) &&                      \
+    !defined(BOOST_HANA_CONFIG_HAS_CXX1Z_FOLD_EXPRESSIONS)
+#   error "this test must be built with fold-expressions enabled"
+#endif
+
+struct never { };  // never satisfies the predicate, at compile-time
+struct always { }; // always satisfies the predicate, at compile-time
+struct invalid { }; // the predicate can't be applied to it
+
+// Predicate returning a runtime result for `int`s, and a compile-time
+// result for `never` and `always`. The `int`s it is called with are
+// recorded in `seen`.
+struct is_two {
+    std::vector<int>& seen;
+
+    bool operator()(int x) const { seen.push_back(x); return x == 2; }
+    constexpr auto operator()(never) const { return hana::false_; }
+    constexpr auto operator()(always) const { return hana::true_; }
+};
+
+// Same as `is_two`, but usable in a constant expression.
+struct count_is_two {
+    int& calls;
+
+    constexpr bool operator()(int x) const { ++calls; return x == 2; }
+    constexpr auto operator()(never) const { return hana::false_; }
+};
+
+template <typename Xs>
+constexpr int calls_until_satisfied(Xs xs) {
+    int calls = 0;
+    bool satisfied = hana::any_of(xs, count_is_two{calls});
+    return satisfied ? calls : -1;
+}
+
+int main() {
+    // Only runtime results; the predicate is not called once it is satisfied.
+    {
+        std::vector<int> seen{};
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::any_of(hana::make_tuple(1, 2, 3, 4), is_two{seen})
+        );
+        BOOST_HANA_RUNTIME_CHECK(seen == std::vector<int>{1, 2});
+
+        seen.clear();
+        BOOST_HANA_RUNTIME_CHECK(
+            !hana::any_of(hana::make_tuple(1, 3, 4), is_two{seen})
+        );
+        BOOST_HANA_RUNTIME_CHECK(seen == std::vector<int>{1, 3, 4});
+    }
+
+    // Runtime results mixed with compile-time false results.
+    {
+        std::vector<int> seen{};
+        BOOST_HANA_RUNTIME_CHECK(hana::any_of(
+            hana::make_tuple(never{}, 1, never{}, 2, never{}, 3), is_two{seen}
+        ));
+        BOOST_HANA_RUNTIME_CHECK(seen == std::vector<int>{1, 2});
+
+        seen.clear();
+        BOOST_HANA_RUNTIME_CHECK(!hana::any_of(
+            hana::make_tuple(1, never{}, 3, never{}), is_two{seen}
+        ));
+        BOOST_HANA_RUNTIME_CHECK(seen == std::vector<int>{1, 3});
+    }
+
+    // Runtime results mixed with a compile-time true result; the result is
+    // known at compile-time, and the predicate is never called at runtime.
+    {
+        std::vector<int> seen{};
+        BOOST_HANA_CONSTANT_CHECK(hana::any_of(
+            hana::make_tuple(1, 2, never{}, always{}, 3), is_two{seen}
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::any_of(
+            hana::make_tuple(always{}, 1, 2), is_two{seen}
+        ));
+        BOOST_HANA_RUNTIME_CHECK(seen.empty());
+
+        BOOST_HANA_CONSTANT_CHECK(!hana::any_of(
+            hana::make_tuple(never{}, never{}), is_two{seen}
+        ));
+        BOOST_HANA_CONSTANT_CHECK(!hana::any_of(hana::make_tuple(), is_two{seen}));
+    }
+
+    // The predicate is not applied to the elements following an element
+    // satisfying it at compile-time.
+    {
+        std::vector<int> seen{};
+        BOOST_HANA_CONSTANT_CHECK(hana::any_of(
+            hana::make_tuple(1, always{}, invalid{}), is_two{seen}
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::all_of(
+            hana::make_tuple(never{}, invalid{}), is_two{seen}
+        ) == hana::false_);
+        BOOST_HANA_CONSTANT_CHECK(hana::is_just(
+            hana::find_if(hana::make_tuple(never{}, always{}, invalid{}),
+                          is_two{seen})
+        ));
+    }
+
+    // The runtime result can be computed in a constant expression.
+    {
+        static_assert(calls_until_satisfied(hana::make_tuple(2)) == 1, "");
+        static_assert(calls_until_satisfied(
+            hana::make_tuple(never{}, 1, never{}, 2, 3, 4)) == 2, "");
+        static_assert(calls_until_satisfied(hana::make_tuple(1, never{}, 3)) == -1, "");
+    }
+}
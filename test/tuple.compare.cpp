@@ -0,0 +1,123 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+// This test is also built with fold-expressions enabled, in which case we
+// make sure that the corresponding implementation is actually used.
+#if defined(BOOST_HANA_TEST_CXX1Z_FOLD_EXPRESSIONS) &&                      \
+    !defined(BOOST_HANA_CONFIG_HAS_CXX1Z_FOLD_EXPRESSIONS)
+#   error "this test must be built with fold-expressions enabled"
+#endif
+
+// Only `Orderable`, not `Comparable`.
+struct only_less {
+    int value;
+    constexpr bool operator<(only_less other) const
+    { return value < other.value; }
+};
+
+// Counts the calls to `less` made at runtime.
+struct counted_less {
+    int value;
+    int* calls;
+    constexpr bool operator<(counted_less other) const
+    { return ++*calls, value < other.value; }
+};
+
+constexpr int calls_to_less(int x0, int y0) {
+    int calls = 0;
+    hana::less(
+        hana::make_tuple(counted_less{x0, &calls}, counted_less{0, &calls}),
+        hana::make_tuple(counted_less{y0, &calls}, counted_less{0, &calls})
+    );
+    return calls;
+}
+
+int main() {
+    // equal with runtime results only
+    {
+        static_assert(hana::equal(hana::make_tuple(1, 2, 3),
+                                  hana::make_tuple(1, 2, 3)), "");
+        static_assert(!hana::equal(hana::make_tuple(1, 2, 3),
+                                   hana::make_tuple(1, 0, 3)), "");
+        static_assert(!hana::equal(hana::make_tuple(1, 2, 3),
+                                   hana::make_tuple(1, 2, 0)), "");
+    }
+
+    // equal with runtime results mixed with compile-time results
+    {
+        static_assert(hana::equal(hana::make_tuple(1, hana::int_<2>, 3),
+                                  hana::make_tuple(1, hana::int_<2>, 3)), "");
+        static_assert(!hana::equal(hana::make_tuple(1, hana::int_<2>, 3),
+                                   hana::make_tuple(0, hana::int_<2>, 3)), "");
+        BOOST_HANA_CONSTANT_CHECK(!hana::equal(
+            hana::make_tuple(1, hana::int_<2>, 3),
+            hana::make_tuple(1, hana::int_<0>, 3)
+        ));
+    }
+
+    // less with runtime results only
+    {
+        static_assert(hana::less(hana::make_tuple(1, 2, 3),
+                                 hana::make_tuple(1, 2, 4)), "");
+        static_assert(hana::less(hana::make_tuple(1, 2, 3),
+                                 hana::make_tuple(1, 3, 0)), "");
+        static_assert(!hana::less(hana::make_tuple(1, 2, 3),
+                                  hana::make_tuple(1, 2, 3)), "");
+        static_assert(!hana::less(hana::make_tuple(2, 0, 0),
+                                  hana::make_tuple(1, 9, 9)), "");
+    }
+
+    // less with runtime results mixed with compile-time results
+    {
+        static_assert(hana::less(hana::make_tuple(1, hana::int_<2>, 3),
+                                 hana::make_tuple(1, hana::int_<2>, 4)), "");
+        static_assert(!hana::less(hana::make_tuple(1, hana::int_<2>, 4),
+                                  hana::make_tuple(1, hana::int_<2>, 3)), "");
+        static_assert(hana::less(hana::make_tuple(1, hana::int_<2>, 9),
+                                 hana::make_tuple(1, hana::int_<3>, 0)), "");
+        BOOST_HANA_CONSTANT_CHECK(hana::less(
+            hana::make_tuple(hana::int_<1>, 9),
+            hana::make_tuple(hana::int_<2>, 0)
+        ));
+    }
+
+    // less only requires the elements to be Orderable
+    {
+        static_assert(hana::less(hana::make_tuple(only_less{1}, only_less{2}),
+                                 hana::make_tuple(only_less{1}, only_less{3})), "");
+        static_assert(!hana::less(hana::make_tuple(only_less{1}, only_less{2}),
+                                  hana::make_tuple(only_less{1}, only_less{2})), "");
+        static_assert(hana::less(hana::make_tuple(only_less{1}),
+                                 hana::make_tuple(only_less{1}, only_less{0})), "");
+    }
+
+    // less stops comparing at the first pair of different elements
+    {
+        static_assert(calls_to_less(0, 1) == 1, "");
+        static_assert(calls_to_less(1, 0) == 2, "");
+        static_assert(calls_to_less(0, 0) == 4, "");
+    }
+
+    // less does not compare the elements following a pair of elements
+    // known to be different at compile-time
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::less(
+            hana::make_tuple(hana::int_<1>, only_less{0}),
+            hana::make_tuple(hana::int_<2>, 0)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(!hana::less(
+            hana::make_tuple(hana::int_<2>, only_less{0}),
+            hana::make_tuple(hana::int_<1>, 0)
+        ));
+    }
+}
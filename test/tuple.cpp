@@ -23,6 +23,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <laws/sequence.hpp>
 #include <laws/traversable.hpp>
 
+#include <cstring>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -40,6 +42,19 @@ struct x0; struct x1; struct x2; struct x3; struct x4;
 template <typename ...>
 struct F { struct type; };
 
+struct empty_class { };
+
+template <typename T>
+constexpr bool is_trivial_tuple() {
+    return std::is_trivially_copyable<T>{} &&
+           std::is_trivially_destructible<T>{} &&
+           std::is_trivially_default_constructible<T>{} &&
+           std::is_trivially_copy_constructible<T>{} &&
+           std::is_trivially_move_constructible<T>{} &&
+           std::is_trivially_copy_assignable<T>{} &&
+           std::is_trivially_move_assignable<T>{};
+}
+
 // a non-movable, non-copyable type
 struct ref_only {
     test::Tracked _track{1};
@@ -139,6 +154,48 @@ int main() {
         Types default_{}; (void)default_;
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // trivial special members and assignment
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // tuples of trivial elements are trivial
+        {
+            static_assert(is_trivial_tuple<_tuple<>>(), "");
+            static_assert(is_trivial_tuple<_tuple<int>>(), "");
+            static_assert(is_trivial_tuple<_tuple<int, float, char>>(), "");
+            static_assert(is_trivial_tuple<_tuple<int, empty_class, double>>(), "");
+            static_assert(is_trivial_tuple<_tuple<empty_class, empty_class>>(), "");
+            static_assert(is_trivial_tuple<_tuple<_tuple<int>, _tuple<char, long>>>(), "");
+            static_assert(is_trivial_tuple<std::remove_const_t<decltype(tuple_t<x0, x1>)>>(), "");
+            static_assert(is_trivial_tuple<std::remove_const_t<decltype(tuple_c<int, 0, 1>)>>(), "");
+            static_assert(is_trivial_tuple<decltype(make<Tuple>(1, 'x', 2.2))>(), "");
+
+            static_assert(!std::is_trivially_copyable<_tuple<int, std::string>>{}, "");
+            static_assert(!std::is_trivially_destructible<_tuple<int, std::string>>{}, "");
+        }
+
+        // copying trivial tuples with std::memcpy
+        {
+            _tuple<int, char, double> xs{1, 'x', 2.2};
+            _tuple<int, char, double> ys;
+            std::memcpy(&ys, &xs, sizeof(xs));
+            BOOST_HANA_RUNTIME_CHECK(ys == make<Tuple>(1, 'x', 2.2));
+        }
+
+        // assignment
+        {
+            _tuple<int, char> xs{1, 'x'};
+            _tuple<int, char> ys{2, 'y'};
+            xs = ys;
+            BOOST_HANA_RUNTIME_CHECK(xs == make<Tuple>(2, 'y'));
+
+            _tuple<int, std::string> strings{1, "abc"};
+            _tuple<int, std::string> copy{};
+            copy = strings;
+            BOOST_HANA_RUNTIME_CHECK(copy == make<Tuple>(1, std::string{"abc"}));
+        }
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // holding references in a tuple
     //////////////////////////////////////////////////////////////////////////
@@ -150,6 +207,95 @@ int main() {
         ref_only& b_ref = at_c<1>(refs); (void)b_ref;
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // tie, forward_as_tuple and algorithms preserving references
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // `ref_only` can't be copied, so these would not compile if any
+        // of the algorithms copied the elements.
+        ref_only a{}, b{}, c{};
+        auto refs = tie(a, b, c);
+        static_assert(std::is_same<
+            decltype(refs), _tuple<ref_only&, ref_only&, ref_only&>
+        >{}, "");
+
+        BOOST_HANA_RUNTIME_CHECK(&at_c<0>(reverse(refs)) == &c);
+        BOOST_HANA_RUNTIME_CHECK(&at_c<2>(reverse(refs)) == &a);
+        BOOST_HANA_RUNTIME_CHECK(&at_c<0>(slice(refs, int_<1>, int_<3>)) == &b);
+        BOOST_HANA_RUNTIME_CHECK(&at_c<1>(take(refs, int_<2>)) == &b);
+        BOOST_HANA_RUNTIME_CHECK(&at_c<0>(drop(refs, int_<2>)) == &c);
+        BOOST_HANA_RUNTIME_CHECK(&at_c<1>(remove_at(refs, int_<1>)) == &c);
+        BOOST_HANA_RUNTIME_CHECK(&at_c<1>(init(refs)) == &b);
+
+        auto keep_all = [](ref_only const&) { return true_; };
+        BOOST_HANA_RUNTIME_CHECK(&at_c<2>(filter(refs, keep_all)) == &c);
+        BOOST_HANA_RUNTIME_CHECK(&at_c<0>(first(partition(refs, keep_all))) == &a);
+
+        // a view over the elements of an existing tuple
+        auto xs = make<Tuple>(1, 'x');
+        auto view = unpack(xs, tie);
+        static_assert(std::is_same<decltype(view), _tuple<int&, char&>>{}, "");
+        at_c<0>(reverse(view)) = 'y';
+        BOOST_HANA_RUNTIME_CHECK(at_c<1>(xs) == 'y');
+
+        // elements held by value are still copied
+        auto copy = reverse(xs);
+        static_assert(std::is_same<decltype(copy), _tuple<char, int>>{}, "");
+
+        // forward_as_tuple
+        int i = 0;
+        auto fwd = forward_as_tuple(i, 1);
+        static_assert(std::is_same<decltype(fwd), _tuple<int&, int&&>>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(&at_c<0>(fwd) == &i);
+        BOOST_HANA_CONSTANT_CHECK(forward_as_tuple() == make<Tuple>());
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // assigning a tuple to another tuple of the same length
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // through the references returned by tie
+        {
+            int x = 0;
+            char y = 'a';
+            tie(x, y) = make<Tuple>(1, 'b');
+            BOOST_HANA_RUNTIME_CHECK(x == 1);
+            BOOST_HANA_RUNTIME_CHECK(y == 'b');
+
+            auto const xs = make<Tuple>(2l, 'c');
+            tie(x, y) = xs;
+            BOOST_HANA_RUNTIME_CHECK(x == 2);
+            BOOST_HANA_RUNTIME_CHECK(y == 'c');
+
+            std::unique_ptr<int> p;
+            tie(p) = make<Tuple>(std::unique_ptr<int>{new int{3}});
+            BOOST_HANA_RUNTIME_CHECK(*p == 3);
+        }
+
+        // converting the elements held by value
+        {
+            _tuple<long, std::string> xs{};
+            xs = make<Tuple>(1, "abc");
+            BOOST_HANA_RUNTIME_CHECK(xs == make<Tuple>(1l, std::string{"abc"}));
+        }
+
+        // only tuples of the same length with assignable elements
+        {
+            static_assert(!std::is_assignable<
+                _tuple<int&, int&>, _tuple<int>
+            >{}, "");
+            static_assert(!std::is_assignable<
+                _tuple<int&>, _tuple<int, int>
+            >{}, "");
+            static_assert(!std::is_assignable<
+                _tuple<int&>, _tuple<std::string>
+            >{}, "");
+            static_assert(!std::is_assignable<
+                _tuple<std::unique_ptr<int>&>, _tuple<std::unique_ptr<int>> const&
+            >{}, "");
+        }
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // using brace initialization to initialize members of the tuple
     //////////////////////////////////////////////////////////////////////////
@@ -230,6 +376,17 @@ int main() {
         BOOST_HANA_CONSTANT_CHECK(equal(tuple_c<int, 0, 1>, tuple_c<int, 0, 1>));
         BOOST_HANA_CONSTANT_CHECK(equal(tuple_c<int, 0, 1, 2>, tuple_c<int, 0, 1, 2>));
 
+        // mixing runtime and compile-time comparisons
+        BOOST_HANA_CONSTANT_CHECK(not_(equal(
+            make_tuple(1, int_<2>), make_tuple(1, int_<3>)
+        )));
+        BOOST_HANA_RUNTIME_CHECK(equal(
+            make_tuple(1, int_<2>, 3), make_tuple(1, int_<2>, 3)
+        ));
+        BOOST_HANA_RUNTIME_CHECK(not_(equal(
+            make_tuple(1, int_<2>, 3), make_tuple(1, int_<2>, 4)
+        )));
+
         test::TestComparable<Tuple>{eq_tuples};
     }
 
@@ -238,6 +395,22 @@ int main() {
     // Orderable
     //////////////////////////////////////////////////////////////////////////
     {
+        // mixing runtime and compile-time comparisons
+        BOOST_HANA_CONSTANT_CHECK(less(
+            make_tuple(int_<1>, 2), make_tuple(int_<2>, 1)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(not_(less(
+            make_tuple(int_<2>, 1), make_tuple(int_<1>, 2)
+        )));
+        BOOST_HANA_RUNTIME_CHECK(less(
+            make_tuple(int_<1>, 1, 2), make_tuple(int_<1>, 1, 3)
+        ));
+        BOOST_HANA_RUNTIME_CHECK(not_(less(
+            make_tuple(int_<1>, 2, 2), make_tuple(int_<1>, 1, 3)
+        )));
+        BOOST_HANA_RUNTIME_CHECK(less(make_tuple(1, 2), make_tuple(1, 2, 3)));
+        BOOST_HANA_RUNTIME_CHECK(not_(less(make_tuple(1, 2), make_tuple(1, 2))));
+
         test::TestOrderable<Tuple>{ord_tuples};
     }
 
@@ -408,6 +581,76 @@ int main() {
             ));
         }
 
+        // fold.balanced with tuple_c
+        {
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold.balanced(tuple_c<int, 1>, plus),
+                int_<1>
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold.balanced(tuple_c<int, 1, 2, 3, 4, 5>, plus),
+                int_<15>
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold.balanced(tuple_c<int, 1, 2, 3, 4, 5>, mult),
+                int_<120>
+            ));
+
+            // the result is the same as with the generic fold
+            static_assert(std::is_same<
+                decltype(fold.balanced(tuple_c<char, 1, 2, 3>, plus)),
+                decltype(fold.left(tuple_c<char, 1, 2, 3>, plus))
+            >{}, "");
+            static_assert(std::is_same<
+                decltype(fold.balanced(tuple_c<unsigned, 4, 5>, mult)),
+                decltype(fold.left(tuple_c<unsigned, 4, 5>, mult))
+            >{}, "");
+
+            // other operations use the generic balanced fold
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold.balanced(tuple_c<int, 1, 2, 3>, minus),
+                minus(minus(int_<1>, int_<2>), int_<3>)
+            ));
+        }
+
+        // visit_at
+        {
+            auto xs = make_tuple(1, '2', 3.3);
+            auto to_int = [](auto x) { return static_cast<int>(x); };
+            auto fallback = [] { return -1; };
+            BOOST_HANA_RUNTIME_CHECK(visit_at(xs, 0, to_int, fallback) == 1);
+            BOOST_HANA_RUNTIME_CHECK(visit_at(xs, 1, to_int, fallback) == '2');
+            BOOST_HANA_RUNTIME_CHECK(visit_at(xs, 2, to_int, fallback) == 3);
+            BOOST_HANA_RUNTIME_CHECK(visit_at(xs, 3, to_int, fallback) == -1);
+            BOOST_HANA_RUNTIME_CHECK(visit_at(make_tuple(), 0, to_int, fallback) == -1);
+
+            // elements are passed by reference
+            visit_at(xs, 1, [](auto& x) { x = 'x'; }, [] { });
+            BOOST_HANA_RUNTIME_CHECK(at_c<1>(xs) == 'x');
+
+            auto index = [](auto n, auto const&) -> unsigned {
+                return decltype(n)::value;
+            };
+            auto no_index = [] { return 99u; };
+            for (unsigned n = 0; n < 3; ++n)
+                BOOST_HANA_RUNTIME_CHECK(visit_at.with_index(xs, n, index, no_index) == n);
+            BOOST_HANA_RUNTIME_CHECK(visit_at.with_index(xs, 3, index, no_index) == 99u);
+        }
+
+        // count_if
+        {
+            auto is_even = [](auto x) { return x % int_<2> == int_<0>; };
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                count_if(make_tuple(), is_even), boost::hana::size_t<0>
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                count_if(tuple_c<int, 1, 2, 3, 4, 6>, is_even), boost::hana::size_t<3>
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                count(make_tuple(int_<1>, int_<2>, int_<1>), int_<1>), boost::hana::size_t<2>
+            ));
+        }
+
         test::TestFoldable<Tuple>{eq_tuples};
     }
 
@@ -510,6 +753,29 @@ int main() {
             , make<Tuple>(false_, false_)
         );
         test::TestSearchable<Tuple>{bool_tuples, make<Tuple>(true_, false_)};
+
+        // mixing runtime and compile-time results of the predicate
+        {
+            auto pred = [](auto x) { return x; };
+            BOOST_HANA_CONSTANT_CHECK(any_of(make_tuple(false, true_), pred));
+            BOOST_HANA_CONSTANT_CHECK(not_(all_of(make_tuple(true, false_), pred)));
+            BOOST_HANA_RUNTIME_CHECK(any_of(make_tuple(false_, true), pred));
+            BOOST_HANA_RUNTIME_CHECK(not_(any_of(make_tuple(false_, false), pred)));
+            BOOST_HANA_RUNTIME_CHECK(all_of(make_tuple(true, true_), pred));
+            BOOST_HANA_RUNTIME_CHECK(none_of(make_tuple(false, false_), pred));
+        }
+
+        // the predicate is not called when the result is known at compile-time
+        {
+            int calls = 0;
+            auto pred = [&](auto x) { ++calls; return x; };
+            BOOST_HANA_CONSTANT_CHECK(any_of(make_tuple(false_, true_), pred));
+            BOOST_HANA_CONSTANT_CHECK(not_(any_of(make_tuple(false_, false_), pred)));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find_if(make_tuple(false_, true_), pred), just(true_)
+            ));
+            BOOST_HANA_RUNTIME_CHECK(calls == 0);
+        }
     }
 
 #elif BOOST_HANA_TEST_PART == 6
@@ -577,6 +843,88 @@ int main() {
             , "");
         }
 
+        // sort with a predicate depending only on the types of the elements
+        {
+            auto by_alignment = [](auto const& x, auto const& y) {
+                return bool_<(alignof(decltype(x)) < alignof(decltype(y)))>;
+            };
+
+            BOOST_HANA_RUNTIME_CHECK(
+                sort(make_tuple(1.0, 'x', 2, short{3}, 'y'), by_alignment) ==
+                make_tuple('x', 'y', short{3}, 2, 1.0)
+            );
+
+            BOOST_HANA_RUNTIME_CHECK(
+                sort(make_tuple(std::string{"abc"}, 'x'), by_alignment) ==
+                make_tuple('x', std::string{"abc"})
+            );
+        }
+
+        // span, take_while, group and unique with predicates depending
+        // only on the types of the elements
+        {
+            auto is_small = [](auto const& x) {
+                return bool_<(sizeof(x) < sizeof(int))>;
+            };
+            auto same_size = [](auto const& x, auto const& y) {
+                return bool_<sizeof(x) == sizeof(y)>;
+            };
+
+            BOOST_HANA_RUNTIME_CHECK(
+                span(make_tuple('x', short{1}, 2, 'y'), is_small) ==
+                make_pair(make_tuple('x', short{1}), make_tuple(2, 'y'))
+            );
+
+            BOOST_HANA_RUNTIME_CHECK(
+                take_while(make_tuple('x', short{1}, 2, 'y'), is_small) ==
+                make_tuple('x', short{1})
+            );
+
+            BOOST_HANA_RUNTIME_CHECK(
+                group(make_tuple('x', 'y', 1, 2, 3, 'z'), same_size) ==
+                make_tuple(make_tuple('x', 'y'), make_tuple(1, 2, 3),
+                           make_tuple('z'))
+            );
+
+            BOOST_HANA_RUNTIME_CHECK(
+                unique(make_tuple('x', 'y', 1, 2, 3, 'z'), same_size) ==
+                make_tuple('x', 1, 'z')
+            );
+        }
+
+        // span and take_while do not apply the predicate past the first
+        // element which does not satisfy it
+        {
+            auto is_small = [](auto const& x) {
+                static_assert(!std::is_same<decltype(x), double const&>{},
+                "the predicate must not be applied past the first int");
+                return bool_<(sizeof(x) < sizeof(int))>;
+            };
+
+            BOOST_HANA_RUNTIME_CHECK(
+                span(make_tuple('x', short{1}, 2, 3.0), is_small) ==
+                make_pair(make_tuple('x', short{1}), make_tuple(2, 3.0))
+            );
+
+            BOOST_HANA_RUNTIME_CHECK(
+                take_while(make_tuple('x', short{1}, 2, 3.0), is_small) ==
+                make_tuple('x', short{1})
+            );
+        }
+
+        // scan.left with runtime values
+        {
+            BOOST_HANA_RUNTIME_CHECK(
+                scan.left(make_tuple(1, 2, 3), 0, plus) ==
+                make_tuple(0, 1, 3, 6)
+            );
+
+            BOOST_HANA_RUNTIME_CHECK(
+                scan.left(make_tuple(1, 2, 3), plus) ==
+                make_tuple(1, 3, 6)
+            );
+        }
+
         test::TestSequence<Tuple>{};
     }
 
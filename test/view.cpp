@@ -0,0 +1,368 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/view.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <test/seq.hpp>
+
+#include <type_traits>
+using namespace boost::hana;
+
+
+template <int i>
+using eq = test::ct_eq<i>;
+
+// Predicate that is true for the permutations starting with `eq<0>` and
+// `eq<2>`, and that can't be instantiated for the permutations starting
+// with `eq<1>`. It is used to make sure the permutations past the first
+// match are never created.
+struct starts_with_0_2 {
+    template <typename Perm>
+    constexpr auto operator()(Perm const& perm) const {
+        using First = typename std::decay<decltype(at_c<0>(perm))>::type;
+        static_assert(!std::is_same<First, eq<1>>{},
+        "a permutation past the first match was created");
+        return equal(at_c<1>(perm), eq<2>{});
+    }
+};
+
+// Function that wraps its argument, and that can't be instantiated with
+// `eq<1>`. It is used to make sure `transform_view` never applies the
+// function to the elements that are not accessed.
+struct wrap_except_1 {
+    template <typename X>
+    constexpr auto operator()(X const& x) const {
+        static_assert(!std::is_same<X, eq<1>>{},
+        "the function was applied to an element that was not accessed");
+        return make<Tuple>(x);
+    }
+};
+
+struct is_not_1 {
+    template <typename X>
+    constexpr auto operator()(X const&) const
+    { return bool_<!std::is_same<X, eq<1>>{}>; }
+};
+
+int main() {
+    auto check_nth = [](auto xs) {
+        auto perms = permutations(xs);
+        auto view = permutations_view(xs);
+        BOOST_HANA_CONSTANT_CHECK(equal(length(view), length(perms)));
+        BOOST_HANA_CONSTANT_CHECK(equal(to<Tuple>(view), perms));
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // nth_permutation
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            nth_permutation<0>(make<Tuple>()),
+            make<Tuple>()
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            nth_permutation<0>(make<Tuple>(eq<0>{}, eq<1>{}, eq<2>{})),
+            make<Tuple>(eq<0>{}, eq<1>{}, eq<2>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            nth_permutation<1>(make<Tuple>(eq<0>{}, eq<1>{}, eq<2>{})),
+            make<Tuple>(eq<0>{}, eq<2>{}, eq<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            nth_permutation<3>(make<Tuple>(eq<0>{}, eq<1>{}, eq<2>{})),
+            make<Tuple>(eq<1>{}, eq<2>{}, eq<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            nth_permutation<5>(make<Tuple>(eq<0>{}, eq<1>{}, eq<2>{})),
+            make<Tuple>(eq<2>{}, eq<1>{}, eq<0>{})
+        ));
+
+        // the data type of the sequence is preserved
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            nth_permutation<1>(test::seq(eq<0>{}, eq<1>{})),
+            test::seq(eq<1>{}, eq<0>{})
+        ));
+
+        // the permutations are in the same order as with `permutations`
+        check_nth(make<Tuple>());
+        check_nth(make<Tuple>(eq<0>{}));
+        check_nth(make<Tuple>(eq<0>{}, eq<1>{}));
+        check_nth(make<Tuple>(eq<0>{}, eq<1>{}, eq<2>{}));
+        check_nth(make<Tuple>(eq<0>{}, eq<1>{}, eq<2>{}, eq<3>{}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // permutations_view
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto xs = make<Tuple>(eq<0>{}, eq<1>{}, eq<2>{});
+        auto view = permutations_view(xs);
+
+        static_assert(std::is_same<datatype_t<decltype(view)>, View>{}, "");
+
+        // Iterable
+        {
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                head(view), make<Tuple>(eq<0>{}, eq<1>{}, eq<2>{})
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                at_c<4>(view), make<Tuple>(eq<2>{}, eq<0>{}, eq<1>{})
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                last(view), make<Tuple>(eq<2>{}, eq<1>{}, eq<0>{})
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                head(tail(view)), make<Tuple>(eq<0>{}, eq<2>{}, eq<1>{})
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                at_c<1>(drop(view, int_<3>)), at_c<4>(view)
+            ));
+            BOOST_HANA_CONSTANT_CHECK(is_empty(drop.at_most(view, int_<10>)));
+            BOOST_HANA_CONSTANT_CHECK(not_(is_empty(view)));
+            BOOST_HANA_CONSTANT_CHECK(is_empty(drop(view, int_<6>)));
+            BOOST_HANA_CONSTANT_CHECK(not_(is_empty(permutations_view(make<Tuple>()))));
+        }
+
+        // Searchable
+        {
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find_if(view, starts_with_0_2{}),
+                just(make<Tuple>(eq<0>{}, eq<2>{}, eq<1>{}))
+            ));
+            BOOST_HANA_CONSTANT_CHECK(any_of(view, starts_with_0_2{}));
+
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find_if(view, [](auto perm) { return equal(at_c<0>(perm), eq<2>{}); }),
+                just(make<Tuple>(eq<2>{}, eq<0>{}, eq<1>{}))
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find_if(view, [](auto perm) { return equal(at_c<0>(perm), eq<3>{}); }),
+                nothing
+            ));
+            BOOST_HANA_CONSTANT_CHECK(not_(
+                any_of(view, [](auto perm) { return equal(at_c<0>(perm), eq<3>{}); })
+            ));
+        }
+
+        // Foldable
+        {
+            int firsts[6] = {};
+            int count = 0;
+            for_each(permutations_view(make<Tuple>(1, 2, 3)), [&](auto perm) {
+                firsts[count++] = at_c<0>(perm);
+            });
+            BOOST_HANA_RUNTIME_CHECK(count == 6);
+            BOOST_HANA_RUNTIME_CHECK(firsts[0] == 1 && firsts[1] == 1);
+            BOOST_HANA_RUNTIME_CHECK(firsts[2] == 2 && firsts[3] == 2);
+            BOOST_HANA_RUNTIME_CHECK(firsts[4] == 3 && firsts[5] == 3);
+
+            BOOST_HANA_RUNTIME_CHECK(
+                to<Tuple>(permutations_view(make<Tuple>(1, '2'))) ==
+                make<Tuple>(make<Tuple>(1, '2'), make<Tuple>('2', 1))
+            );
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // cartesian_product_view
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto check = [](auto xs) {
+            auto product = cartesian_product(xs);
+            auto view = cartesian_product_view(xs);
+            BOOST_HANA_CONSTANT_CHECK(equal(length(view), length(product)));
+            BOOST_HANA_CONSTANT_CHECK(equal(to<Tuple>(view), product));
+        };
+
+        // the combinations are in the same order as with `cartesian_product`
+        check(make<Tuple>());
+        check(make<Tuple>(make<Tuple>()));
+        check(make<Tuple>(make<Tuple>(eq<0>{})));
+        check(make<Tuple>(make<Tuple>(eq<0>{}, eq<1>{})));
+        check(make<Tuple>(make<Tuple>(eq<0>{}), make<Tuple>()));
+        check(make<Tuple>(make<Tuple>(eq<0>{}, eq<1>{}),
+                          make<Tuple>(eq<2>{}, eq<3>{}, eq<4>{})));
+        check(make<Tuple>(make<Tuple>(eq<0>{}, eq<1>{}),
+                          make<Tuple>(eq<2>{}),
+                          make<Tuple>(eq<3>{}, eq<4>{}, eq<5>{})));
+
+        auto view = cartesian_product_view(make<Tuple>(
+            make<Tuple>(eq<0>{}, eq<1>{}),
+            make<Tuple>(eq<2>{}, eq<3>{}, eq<4>{})
+        ));
+
+        // Iterable
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            at_c<0>(view), make<Tuple>(eq<0>{}, eq<2>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            at_c<4>(view), make<Tuple>(eq<1>{}, eq<3>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            last(view), make<Tuple>(eq<1>{}, eq<4>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            head(drop(view, int_<3>)), make<Tuple>(eq<1>{}, eq<2>{})
+        ));
+
+        // Searchable
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            find_if(view, [](auto x) { return equal(at_c<1>(x), eq<3>{}); }),
+            just(make<Tuple>(eq<0>{}, eq<3>{}))
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            find_if(view, [](auto x) { return equal(at_c<1>(x), eq<0>{}); }),
+            nothing
+        ));
+
+        // Foldable
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            unpack(view, [](auto ...x) { return make<Tuple>(at_c<1>(x)...); }),
+            make<Tuple>(eq<2>{}, eq<3>{}, eq<4>{}, eq<2>{}, eq<3>{}, eq<4>{})
+        ));
+
+        int sum = 0;
+        for_each(cartesian_product_view(make<Tuple>(make<Tuple>(1, 2),
+                                                    make<Tuple>(10, 20, 30))),
+        [&](auto x) {
+            sum += at_c<0>(x) * at_c<1>(x);
+        });
+        BOOST_HANA_RUNTIME_CHECK(sum == (1 + 2) * (10 + 20 + 30));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // transform_view
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto xs = make<Tuple>(eq<0>{}, eq<1>{}, eq<2>{});
+        auto view = transform_view(xs, wrap_except_1{});
+
+        BOOST_HANA_CONSTANT_CHECK(equal(length(view), boost::hana::size_t<3>));
+        BOOST_HANA_CONSTANT_CHECK(equal(head(view), make<Tuple>(eq<0>{})));
+        BOOST_HANA_CONSTANT_CHECK(equal(last(view), make<Tuple>(eq<2>{})));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            find_if(view, [](auto x) { return equal(x, make<Tuple>(eq<0>{})); }),
+            just(make<Tuple>(eq<0>{}))
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Tuple>(transform_view(xs, test::_injection<0>{})),
+            transform(xs, test::_injection<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Tuple>(transform_view(make<Tuple>(), test::_injection<0>{})),
+            make<Tuple>()
+        ));
+
+        // the elements are passed to the function by reference
+        int ints[3] = {};
+        auto refs = make<Tuple>(0, 1, 2);
+        for_each(transform_view(refs, [&](int const& x) -> int const& {
+            return x;
+        }), [&](int const& x) {
+            ints[&x - &at_c<0>(refs)] = x + 10;
+        });
+        BOOST_HANA_RUNTIME_CHECK(ints[0] == 10 && ints[1] == 11 && ints[2] == 12);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // filter_view
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto xs = make<Tuple>(eq<0>{}, eq<1>{}, eq<2>{}, eq<1>{}, eq<3>{});
+        auto view = filter_view(xs, is_not_1{});
+
+        BOOST_HANA_CONSTANT_CHECK(equal(length(view), boost::hana::size_t<3>));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Tuple>(view), make<Tuple>(eq<0>{}, eq<2>{}, eq<3>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(at_c<1>(view), eq<2>{}));
+        BOOST_HANA_CONSTANT_CHECK(equal(head(tail(view)), eq<2>{}));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            find_if(view, [](auto x) { return equal(x, eq<3>{}); }),
+            just(eq<3>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(not_(
+            any_of(view, [](auto x) { return equal(x, eq<1>{}); })
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(is_empty(filter_view(make<Tuple>(), is_not_1{})));
+        BOOST_HANA_CONSTANT_CHECK(is_empty(
+            filter_view(make<Tuple>(eq<1>{}, eq<1>{}), is_not_1{})
+        ));
+
+        // the elements are accessed by reference
+        auto ints = make<Tuple>(1, '2', 3);
+        auto only_ints = filter_view(ints, [](auto x) {
+            return bool_<std::is_same<decltype(x), int>{}>;
+        });
+        BOOST_HANA_RUNTIME_CHECK(&at_c<1>(only_ints) == &at_c<2>(ints));
+        BOOST_HANA_RUNTIME_CHECK(to<Tuple>(only_ints) == make<Tuple>(1, 3));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // slice_view and reverse_view
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto xs = make<Tuple>(eq<0>{}, eq<1>{}, eq<2>{}, eq<3>{});
+
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Tuple>(slice_view(xs, int_<1>, int_<3>)),
+            make<Tuple>(eq<1>{}, eq<2>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(is_empty(slice_view(xs, int_<2>, int_<2>)));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Tuple>(slice_view(xs, int_<0>, int_<4>)), xs
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Tuple>(slice_view(slice_view(xs, int_<1>, int_<4>), int_<1>, int_<3>)),
+            make<Tuple>(eq<2>{}, eq<3>{})
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(equal(to<Tuple>(reverse_view(xs)), reverse(xs)));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Tuple>(reverse_view(make<Tuple>())), make<Tuple>()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Tuple>(reverse_view(slice_view(xs, int_<0>, int_<3>))),
+            make<Tuple>(eq<2>{}, eq<1>{}, eq<0>{})
+        ));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Compositions of views never copy the underlying elements
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto xs = make<Tuple>(test::no_copy{}, 1, test::no_copy{}, '2');
+        auto view = transform_view(
+            filter_view(
+                slice_view(reverse_view(xs), int_<0>, int_<3>),
+                [](auto const& x) {
+                    return bool_<std::is_same<decltype(x), test::no_copy const&>{}>;
+                }
+            ),
+            [](test::no_copy const& x) -> test::no_copy const& { return x; }
+        );
+        BOOST_HANA_CONSTANT_CHECK(equal(length(view), boost::hana::size_t<1>));
+        BOOST_HANA_RUNTIME_CHECK(&head(view) == &at_c<2>(xs));
+
+        // the composition is equivalent to the eager version
+        auto ys = make<Tuple>(eq<0>{}, eq<1>{}, eq<2>{}, eq<3>{}, eq<1>{});
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Tuple>(transform_view(filter_view(reverse_view(ys), is_not_1{}),
+                                     test::_injection<0>{})),
+            transform(filter(reverse(ys), is_not_1{}), test::_injection<0>{})
+        ));
+    }
+}